@@ -0,0 +1,128 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+namespace Bench
+{
+
+static inline double now_ns()
+{
+	auto ts = timespec{};
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9) + ts.tv_nsec;
+}
+
+// Run func in doubling batches until min_ns has elapsed,
+// return nanoseconds per call
+template <typename Func>
+static double measure(Func&& func, double min_ns = 2e8)
+{
+	auto iterations = size_t{1};
+	while (true) {
+		auto start = now_ns();
+		for (size_t i = 0; i < iterations; i++) {
+			func();
+		}
+		auto elapsed = now_ns() - start;
+		if (elapsed >= min_ns) {
+			return elapsed / iterations;
+		}
+		iterations *= 2;
+	}
+}
+
+// Append result to the tab-separated file named by BENCH_RESULTS, if
+// set, as "name<TAB>value<TAB>unit". Lower values are better
+static inline void record(char const* name, double value, char const* unit)
+{
+	auto path = ::getenv("BENCH_RESULTS");
+	if ((path == nullptr) || (path[0] == '\0')) {
+		return;
+	}
+	auto file = ::fopen(path, "a");
+	if (file == nullptr) {
+		throw std::runtime_error(std::string{"failed to open "} + path);
+	}
+	fprintf(file, "%s\t%.1f\t%s\n", name, value, unit);
+	::fclose(file);
+}
+
+static inline void report(char const* name, double ns_per_op)
+{
+	printf("%-32s %12.1f ns/op\n", name, ns_per_op);
+	record(name, ns_per_op, "ns/op");
+}
+
+static inline auto read_file(char const* path)
+{
+	auto file = ::fopen(path, "rb");
+	if (file == nullptr) {
+		throw std::runtime_error(std::string{"failed to open "} + path);
+	}
+
+	auto result = std::vector<unsigned char>{};
+	unsigned char chunk[4096];
+	while (auto size = ::fread(chunk, 1, sizeof(chunk), file)) {
+		result.insert(result.end(), chunk, chunk + size);
+	}
+	::fclose(file);
+
+	return result;
+}
+
+// Write contents to a new temporary file, caller unlinks it
+static inline std::string write_temp_file(char const* prefix, std::string const& contents)
+{
+	auto path = std::string{"/tmp/"} + prefix + ".XXXXXX";
+	auto fd = ::mkstemp(path.data());
+	if (fd < 0) {
+		throw std::runtime_error("failed to create " + path);
+	}
+	auto written = ::write(fd, contents.data(), contents.size());
+	::close(fd);
+	if (written != (ssize_t)contents.size()) {
+		::unlink(path.c_str());
+		throw std::runtime_error("failed to write " + path);
+	}
+	return path;
+}
+
+// Symbol layer of the Beepy keymap
+static auto const symbol_keymap = std::string
+	{ "altgr keycode 16 = numbersign\n"
+	  "altgr keycode 17 = 1\n"
+	  "altgr keycode 18 = 2\n"
+	  "altgr keycode 19 = 3\n"
+	  "altgr keycode 20 = parenleft\n"
+	  "altgr keycode 21 = parenright\n"
+	  "altgr keycode 22 = underscore\n"
+	  "altgr keycode 23 = minus\n"
+	  "altgr keycode 24 = plus\n"
+	  "altgr keycode 25 = at\n"
+	  "altgr keycode 30 = asterisk\n"
+	  "altgr keycode 31 = 4\n"
+	  "altgr keycode 32 = 5\n"
+	  "altgr keycode 33 = 6\n"
+	  "altgr keycode 34 = slash\n"
+	  "altgr keycode 35 = colon\n"
+	  "altgr keycode 36 = semicolon\n"
+	  "altgr keycode 37 = apostrophe\n"
+	  "altgr keycode 38 = quotedbl\n"
+	  "altgr keycode 44 = 7\n"
+	  "altgr keycode 45 = 8\n"
+	  "altgr keycode 46 = 9\n"
+	  "altgr keycode 47 = question\n"
+	  "altgr keycode 48 = exclam\n"
+	  "altgr keycode 49 = comma\n"
+	  "altgr keycode 50 = period\n"
+	  "altgr keycode 113 = dollar\n"
+};
+
+} // namespace Bench
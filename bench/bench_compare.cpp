@@ -0,0 +1,83 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <map>
+#include <string>
+#include <stdexcept>
+
+// Compare results files written through BENCH_RESULTS, flag results that
+// grew by more than the threshold over the baseline. Exits 1 on any
+// regression
+
+struct Result
+{
+	double value;
+	std::string unit;
+};
+
+static auto read_results(char const* path)
+{
+	auto file = ::fopen(path, "r");
+	if (file == nullptr) {
+		throw std::runtime_error(std::string{"failed to open "} + path);
+	}
+
+	// Last result wins if a bench ran twice
+	auto result = std::map<std::string, Result>{};
+	char name[256];
+	char unit[64];
+	auto value = double{};
+	while (::fscanf(file, "%255[^\t]\t%lf\t%63[^\n]\n", name, &value, unit) == 3) {
+		result[name] = Result{value, unit};
+	}
+	::fclose(file);
+
+	return result;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s baseline.tsv results.tsv [threshold_percent]\n", argv[0]);
+		return 1;
+	}
+	auto const threshold = (argc > 3)
+		? std::stod(argv[3]) / 100
+		: 0.10;
+
+	auto const baseline = read_results(argv[1]);
+	auto const current = read_results(argv[2]);
+
+	auto regressions = 0;
+	for (auto const& [name, cur] : current) {
+		auto it = baseline.find(name);
+		if ((it == baseline.end()) || (it->second.unit != cur.unit)) {
+			printf("%-32s %12.1f %-6s (new)\n", name.c_str(), cur.value, cur.unit.c_str());
+			continue;
+		}
+
+		auto const base = it->second.value;
+		auto const change = (base > 0)
+			? (cur.value / base) - 1
+			: 0;
+		auto const regressed = (change > threshold);
+		printf("%-32s %12.1f %-6s %+7.1f%%%s\n", name.c_str(), cur.value, cur.unit.c_str(),
+			change * 100, regressed ? "  REGRESSION" : "");
+		if (regressed) {
+			regressions++;
+		}
+	}
+	for (auto const& [name, base] : baseline) {
+		if (current.find(name) == current.end()) {
+			printf("%-32s %12s %-6s (missing)\n", name.c_str(), "-", base.unit.c_str());
+		}
+	}
+
+	if (regressions > 0) {
+		fprintf(stderr, "%d result(s) regressed more than %.0f%%\n",
+			regressions, threshold * 100);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <dirent.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+
+#include "bench.hpp"
+
+#include "Control.hpp"
+
+using namespace std::literals;
+
+// Whole symbol-overlay runs against the in-memory driver: process start,
+// keymap load, render or cache lookup, and overlay calls
+
+extern char** environ;
+
+static auto spawn(std::vector<std::string> const& args)
+{
+	auto argv = std::vector<char*>{};
+	for (auto const& arg : args) {
+		argv.push_back(const_cast<char*>(arg.c_str()));
+	}
+	argv.push_back(nullptr);
+
+	// Discard overlay program output
+	auto actions = posix_spawn_file_actions_t{};
+	::posix_spawn_file_actions_init(&actions);
+	::posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+
+	auto pid = pid_t{};
+	auto rc = ::posix_spawn(&pid, argv[0], &actions, nullptr, argv.data(), environ);
+	::posix_spawn_file_actions_destroy(&actions);
+	if (rc != 0) {
+		throw std::runtime_error("failed to run " + args[0]);
+	}
+	return pid;
+}
+
+static void run(std::vector<std::string> const& args)
+{
+	auto status = int{};
+	if ((::waitpid(spawn(args), &status, 0) < 0)
+	 || !WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+		throw std::runtime_error(args[0] + " failed");
+	}
+}
+
+static void report_run(char const* name, std::vector<std::string> const& args)
+{
+	run(args);
+	Bench::report(name, Bench::measure([&]() { run(args); }, 1e9));
+}
+
+// Cache directory holds only entry files
+static void remove_cache_dir(char const* dir_path)
+{
+	if (auto dir = ::opendir(dir_path)) {
+		while (auto ent = ::readdir(dir)) {
+			auto name = std::string_view{ent->d_name};
+			if ((name != ".") && (name != "..")) {
+				::unlinkat(::dirfd(dir), ent->d_name, 0);
+			}
+		}
+		::closedir(dir);
+	}
+	::rmdir(dir_path);
+}
+
+// Daemon creates its socket after loading every layer
+static auto connect(char const* socket_path)
+{
+	for (int i = 0; i < 500; i++) {
+		try {
+			return std::make_unique<Control::Client>(socket_path);
+		} catch (std::exception const&) {
+			::usleep(10000);
+		}
+	}
+	throw std::runtime_error("daemon did not start");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s path/to/symbol-overlay\n", argv[0]);
+		return 1;
+	}
+	auto const program = std::string{argv[1]};
+
+	auto const keymap_path = Bench::write_temp_file("bench_e2e", Bench::symbol_keymap);
+	char cache_template[] = "/tmp/bench_e2e_cache.XXXXXX";
+	auto cache_dir = ::mkdtemp(cache_template);
+	if (cache_dir == nullptr) {
+		::unlink(keymap_path.c_str());
+		fprintf(stderr, "failed to create cache directory\n");
+		return 1;
+	}
+
+	auto const common = std::vector<std::string>
+		{ program, "--backend=mock:", "--state=", "--keymap=" + keymap_path
+		, "--compiled-keymap=/nonexistent"
+	};
+	auto with = [&](std::vector<std::string> args) {
+		args.insert(args.begin(), common.begin(), common.end());
+		return args;
+	};
+
+	auto status = 0;
+	try {
+		report_run("e2e_meta_prerendered", with({"--meta", "--cache-dir="}));
+		report_run("e2e_symbol_render", with({"--cache-dir="}));
+		report_run("e2e_symbol_cached", with({"--cache-dir="s + cache_dir}));
+
+		// Round trip of show then hide through a running daemon
+		auto const socket_path = "/tmp/bench_e2e.sock."s + std::to_string(::getpid());
+		auto daemon = spawn(with({"--daemon", "--cache-dir=", "--socket=" + socket_path}));
+		try {
+			auto client = connect(socket_path.c_str());
+			auto const show = Control::make_Request(Control::Command::Show, Control::Layer::Symbol);
+			auto const hide = Control::make_Request(Control::Command::Hide, Control::Layer::Symbol);
+			Bench::report("e2e_daemon_show_hide", Bench::measure([&]() {
+				if ((client->send(show).error != 0) || (client->send(hide).error != 0)) {
+					throw std::runtime_error("daemon command failed");
+				}
+			}));
+		} catch (...) {
+			::kill(daemon, SIGTERM);
+			::waitpid(daemon, nullptr, 0);
+			throw;
+		}
+		::kill(daemon, SIGTERM);
+		::waitpid(daemon, nullptr, 0);
+
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "%s\n", ex.what());
+		status = 1;
+	}
+
+	::unlink(keymap_path.c_str());
+	remove_cache_dir(cache_dir);
+
+	return status;
+}
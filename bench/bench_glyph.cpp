@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#include "PSF.hpp"
+
+#include "bench.hpp"
+
+static constexpr auto buf_width = 400;
+static constexpr auto buf_height = 111;
+
+// Previous column-major, per-pixel clipped loop, kept as reference
+static void draw_reference(unsigned char const* glyph, int charsize,
+	unsigned char *buf, int x, int y, int scale)
+{
+	for (int sy = 0; sy < charsize; sy++) {
+		auto dy = y + (scale * sy);
+		if (dy >= buf_height) {
+			break;
+		}
+		for (int sx = 0; sx < 8; sx++) {
+			auto dx = x + (scale * sx);
+			if (dx >= buf_width) {
+				break;
+			}
+			auto pixel = (glyph[sy] >> (7 - sx)) & 1;
+			for (int dsx = 0; dsx < scale; dsx++) {
+				for (int dsy = 0; dsy < scale; dsy++) {
+					buf[((dy + dsy) * buf_width) + dx + dsx] = (pixel ? 0x00 : 0xff);
+				}
+			}
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	auto font = Bench::read_file((argc > 1) ? argv[1] : "font.psf");
+	auto psf = PSF{font.data(), font.size()};
+	auto charsize = (int)psf.getHeight();
+	auto buf = std::vector<unsigned char>(buf_width * buf_height);
+
+	// Glyph for 'A' in a standard PSF1 layout
+	auto glyph = font.data() + sizeof(PSF::psf1_header) + (charsize * 'A');
+
+	for (auto scale : {1, 2, 4}) {
+		auto reference = Bench::measure([&]() {
+			draw_reference(glyph, charsize, buf.data(), 16, 8, scale);
+		});
+		auto blit = Bench::measure([&]() {
+			psf.drawUtf16('A', buf.data(), buf_width, buf_height, 16, 8, scale);
+		});
+
+		char name[64];
+		::snprintf(name, sizeof(name), "glyph_reference_x%d", scale);
+		Bench::report(name, reference);
+		::snprintf(name, sizeof(name), "glyph_blit_x%d", scale);
+		Bench::report(name, blit);
+		printf("%-32s %12.2fx\n", "speedup", reference / blit);
+	}
+
+	// Packed 1bpp target at an unaligned x
+	auto mono_pitch = (buf_width + 7) / 8;
+	auto mono = std::vector<unsigned char>(mono_pitch * buf_height);
+	for (auto scale : {1, 2, 4}) {
+		auto packed = Bench::measure([&]() {
+			psf.drawUtf16Mono('A', mono.data(), mono_pitch, buf_width, buf_height, 19, 8, scale);
+		});
+
+		char name[64];
+		::snprintf(name, sizeof(name), "glyph_mono_x%d", scale);
+		Bench::report(name, packed);
+	}
+
+	// Pre-expanded glyphs, cycling through the alphabet
+	psf.enableGlyphCache(128);
+	for (auto scale : {1, 2, 4}) {
+		auto c = 0;
+		auto cached = Bench::measure([&]() {
+			psf.drawUtf16('A' + (c++ % 26), buf.data(), buf_width, buf_height, 16, 8, scale);
+		});
+
+		char name[64];
+		::snprintf(name, sizeof(name), "glyph_cached_x%d", scale);
+		Bench::report(name, cached);
+	}
+	auto stats = psf.getCacheStats();
+	printf("glyph cache: %zu hits, %zu misses, %zu evictions\n",
+		stats.hits, stats.misses, stats.evictions);
+
+	return 0;
+}
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <unistd.h>
+
+#include <map>
+#include <string>
+#include <fstream>
+#include <stdexcept>
+
+#include "KeymapFile.hpp"
+
+#include "bench.hpp"
+
+using namespace std::literals;
+
+// Previous iostream parser, kept as reference
+static auto parse_reference(char const* keymap_path)
+{
+	auto result = std::map<int, std::string>{};
+
+	auto keymap = std::ifstream{keymap_path};
+	auto line = std::string{};
+	while (std::getline(keymap, line)) {
+		if (line.empty() || (line[0] == '#')) {
+			continue;
+		}
+		if (line.find("altgr ") != 0) {
+			continue;
+		}
+		auto keycode_delim = std::string{"keycode "};
+		auto keycode_at = line.find(keycode_delim);
+		if (keycode_at == std::string::npos) {
+			continue;
+		}
+		auto keycode = std::stoi(line.substr(keycode_at + keycode_delim.size()));
+		auto equals_at = line.find("=");
+		if (equals_at == std::string::npos) {
+			continue;
+		}
+		auto mapping = line.substr(equals_at + 1);
+		auto hash_at = mapping.find("#");
+		if (hash_at != std::string::npos) {
+			mapping = mapping.substr(0, hash_at);
+		}
+		mapping.erase(0, mapping.find_first_not_of(" "));
+		mapping.erase(mapping.find_last_not_of(" ") + 1);
+		result[keycode] = std::move(mapping);
+	}
+
+	return result;
+}
+
+// Keymap shaped like kbd output: plain, shifted and altgr lines with comments
+static auto make_keymap(size_t num_keys)
+{
+	auto result = "# synthetic keymap\nkeymaps 0-2,4-5,8,12\n"s;
+	for (size_t i = 0; i < num_keys; i++) {
+		auto keycode = std::to_string(i % 256);
+		result += "keycode " + keycode + " = a\n";
+		result += "\tshift keycode " + keycode + " = A\n";
+		result += "altgr keycode " + keycode + " = numbersign   # symbol " + keycode + "\n";
+		result += "#altgr keycode " + keycode + " = disabled\n";
+	}
+	return result;
+}
+
+static void write_file(char const* path, std::string const& contents)
+{
+	auto file = ::fopen(path, "wb");
+	if (file == nullptr) {
+		throw std::runtime_error("failed to create "s + path);
+	}
+	::fwrite(contents.data(), 1, contents.size(), file);
+	::fclose(file);
+}
+
+int main()
+{
+	char path[] = "/tmp/bench_keymap.XXXXXX";
+	auto fd = ::mkstemp(path);
+	if (fd < 0) {
+		perror("mkstemp");
+		return 1;
+	}
+	::close(fd);
+
+	for (auto num_keys : {32, 100000}) {
+		write_file(path, make_keymap(num_keys));
+
+		// Both parsers must agree on the final mapping
+		auto reference = parse_reference(path);
+		auto keymapFile = KeymapFile{path};
+		auto merged = std::map<int, std::string>{};
+		for (auto const& [keycode, name] : keymapFile.parse()) {
+			merged[keycode] = std::string{name};
+		}
+		if (merged != reference) {
+			fprintf(stderr, "parser mismatch\n");
+			return 1;
+		}
+
+		auto reference_ns = Bench::measure([&]() {
+			parse_reference(path);
+		});
+		auto file_ns = Bench::measure([&]() {
+			KeymapFile{path}.parse();
+		});
+
+		char name[64];
+		::snprintf(name, sizeof(name), "keymap_reference_%d", num_keys);
+		Bench::report(name, reference_ns);
+		::snprintf(name, sizeof(name), "keymap_file_%d", num_keys);
+		Bench::report(name, file_ns);
+		printf("%-32s %12.2fx\n", "speedup", reference_ns / file_ns);
+	}
+
+	::unlink(path);
+
+	return 0;
+}
@@ -0,0 +1,67 @@
+#include <stdio.h>
+
+#include <string>
+#include <stdexcept>
+
+#include "bench.hpp"
+
+#include "KeymapRender.hpp"
+#include "Keymaps.hpp"
+#include "LcdSimBackend.hpp"
+
+// Estimated panel cost of showing and hiding each overlay in each
+// pixel format and layout, placed as symbol-overlay places it
+
+static void report_lcd(char const* name, KeymapRender const& keymapRender, uint32_t spi_hz)
+{
+	auto lcdSim = LcdSimBackend{spi_hz, LcdSimBackend::default_vcom_hz, nullptr};
+
+	auto storage = lcdSim.add(keymapRender.getX(), keymapRender.getY(),
+		keymapRender.getWidth(), keymapRender.getHeight(), keymapRender.get(),
+		keymapRender.getFormat());
+	if (storage == nullptr) {
+		throw std::runtime_error("format unsupported");
+	}
+	auto display = lcdSim.show(storage);
+	auto show = lcdSim.getTotals();
+	lcdSim.hide(display);
+	auto const& totals = lcdSim.getTotals();
+
+	printf("%-32s %4zux%-3zu upload %6zu B  show %3zu lines %5zu B %7.3f ms"
+		"  hide %7.3f ms\n",
+		name, keymapRender.getWidth(), keymapRender.getHeight(), totals.uploadBytes,
+		show.lines, show.bytes, show.transferNs / 1e6,
+		(totals.transferNs - show.transferNs) / 1e6);
+
+	auto key = std::string{name};
+	Bench::record((key + "_upload").c_str(), totals.uploadBytes, "B");
+	Bench::record((key + "_show").c_str(), show.transferNs, "ns");
+	Bench::record((key + "_hide").c_str(), totals.transferNs - show.transferNs, "ns");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s font.psf [spi_hz]\n", argv[0]);
+		return 1;
+	}
+	auto const font = Bench::read_file(argv[1]);
+	auto const spi_hz = (argc > 2)
+		? (uint32_t)std::stoul(argv[2])
+		: LcdSimBackend::default_spi_hz;
+
+	auto metaGray = KeymapRender{font.data(), font.size(), symkeyMetaMap, PixelFormat::Gray8};
+	auto metaMono = KeymapRender{font.data(), font.size(), symkeyMetaMap, PixelFormat::Mono1};
+	report_lcd("lcd_meta_gray8", metaGray, spi_hz);
+	report_lcd("lcd_meta_mono1", metaMono, spi_hz);
+
+	auto const compact = KeymapRender::Layout::Compact;
+	auto compactGray = KeymapRender{font.data(), font.size(), symkeyMetaMap, PixelFormat::Gray8,
+		compact};
+	auto compactMono = KeymapRender{font.data(), font.size(), symkeyMetaMap, PixelFormat::Mono1,
+		compact};
+	report_lcd("lcd_meta_compact_gray8", compactGray, spi_hz);
+	report_lcd("lcd_meta_compact_mono1", compactMono, spi_hz);
+
+	return 0;
+}
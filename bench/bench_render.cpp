@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <unistd.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bench.hpp"
+
+#include "KeymapRender.hpp"
+#include "Keymaps.hpp"
+
+using namespace std::literals;
+
+// Generated tables, included for the name pool as the lookup corpus
+#include "x11name_to_utf16.cpp"
+
+// Keeps measured results observable
+static volatile auto sink = uintptr_t{0};
+
+static auto get_x11names()
+{
+	auto result = std::vector<std::string_view>{};
+	for (size_t offs = 0; offs + 1 < sizeof(x11name_pool); ) {
+		auto name = std::string_view{&x11name_pool[offs]};
+		result.push_back(name);
+		offs += name.size() + 1;
+	}
+	return result;
+}
+
+// Same keys with every label changed
+static auto shift_labels(KeymapRender::Keymap keymap)
+{
+	for (auto& [symkey, utf16] : keymap) {
+		utf16 = (utf16 == 'A') ? 'B' : 'A';
+	}
+	return keymap;
+}
+
+// Alternate between two keymaps, so each render redraws the cells
+// that differ between them
+static void report_render(char const* name, KeymapRender& keymapRender,
+	KeymapRender::Keymap const& a, KeymapRender::Keymap const& b)
+{
+	auto flip = false;
+	auto ns = Bench::measure([&]() {
+		keymapRender.render((flip = !flip) ? a : b);
+		sink = (uintptr_t)keymapRender.get()[0];
+	});
+	Bench::report(name, ns);
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s font.psf\n", argv[0]);
+		return 1;
+	}
+	auto const font = Bench::read_file(argv[1]);
+
+	// Keysym names, every one a hit, then the same names missing
+	auto const names = get_x11names();
+	auto missing = std::vector<std::string>{};
+	for (auto name : names) {
+		missing.push_back(std::string{name} + "_");
+	}
+	auto i = size_t{0};
+	Bench::report("x11name_hit", Bench::measure([&]() {
+		sink = x11name_to_utf16(names[i++ % names.size()]);
+	}));
+	Bench::report("x11name_miss", Bench::measure([&]() {
+		sink = x11name_to_utf16(missing[i++ % missing.size()]);
+	}));
+	printf("%-32s %12zu names\n", "x11name_corpus", names.size());
+
+	// Header check and UTF-16 table build
+	Bench::report("psf_utf16_table", Bench::measure([&]() {
+		auto psf = PSF{font.data(), font.size()};
+		sink = psf.getHeight();
+	}));
+
+	auto const keymap_path = Bench::write_temp_file("bench_render", Bench::symbol_keymap);
+	auto const keymap = parse_symkey_map(keymap_path);
+	::unlink(keymap_path.c_str());
+	auto const shifted = shift_labels(keymap);
+	auto oneChanged = keymap;
+	oneChanged.begin()->second = (oneChanged.begin()->second == 'A') ? 'B' : 'A';
+
+	for (auto format : {PixelFormat::Gray8, PixelFormat::Mono1}) {
+		auto const suffix = (format == PixelFormat::Mono1) ? "mono1" : "gray8";
+		auto name = std::string{};
+
+		// Every cell of Symbol layer redrawn from the atlas
+		auto keymapRender = KeymapRender{font.data(), font.size(), format};
+		name = "render_keymap_all_"s + suffix;
+		report_render(name.c_str(), keymapRender, keymap, shifted);
+
+		// Keymap edit touching one cell
+		name = "render_keymap_one_"s + suffix;
+		report_render(name.c_str(), keymapRender, keymap, oneChanged);
+
+		// Meta layer, always drawn in full
+		name = "render_three_keymap_"s + suffix;
+		Bench::report(name.c_str(), Bench::measure([&]() {
+			keymapRender.render(symkeyMetaMap);
+			sink = (uintptr_t)keymapRender.get()[0];
+		}));
+	}
+
+	// Compact layout re-crops after each render
+	auto compactRender = KeymapRender{font.data(), font.size(), PixelFormat::Mono1,
+		KeymapRender::Layout::Compact};
+	report_render("render_keymap_all_compact_mono1", compactRender, keymap, shifted);
+
+	return 0;
+}
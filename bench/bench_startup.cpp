@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "bench.hpp"
+
+#include "KeymapRender.hpp"
+#include "KeymapFile.hpp"
+#include "Keymaps.hpp"
+#include "Prerendered.hpp"
+#include "fnv1a.hpp"
+
+// Work done before OV_ADD: rendering at startup versus validating a
+// bitmap rendered at build time
+
+// Keeps measured results observable
+static volatile auto sink = uintptr_t{0};
+
+// Same layout prerender.cpp writes
+static auto make_prerendered(KeymapRender const& keymapRender, uint64_t keymap_hash)
+{
+	auto header = Prerendered::Header{};
+	::memcpy(header.magic, Prerendered::magic, sizeof(Prerendered::magic));
+	header.version = Prerendered::version;
+	header.width = keymapRender.getWidth();
+	header.height = keymapRender.getHeight();
+	header.format = (uint32_t)keymapRender.getFormat();
+	header.keymapHash = keymap_hash;
+
+	auto size = keymapRender.getPitch() * keymapRender.getHeight();
+	auto result = std::vector<unsigned char>(sizeof(header) + size);
+	::memcpy(result.data(), &header, sizeof(header));
+	::memcpy(result.data() + sizeof(header), keymapRender.get(), size);
+	return result;
+}
+
+static bool same_pixels(std::optional<Prerendered::View> const& view,
+	KeymapRender const& keymapRender)
+{
+	return view
+		&& (::memcmp(view->pixels, keymapRender.get(),
+			keymapRender.getPitch() * keymapRender.getHeight()) == 0);
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s font.psf\n", argv[0]);
+		return 1;
+	}
+	auto const font = Bench::read_file(argv[1]);
+
+	auto const keymap_path = Bench::write_temp_file("bench_startup", Bench::symbol_keymap);
+	auto const path = keymap_path.c_str();
+
+	// Build-time renders, as linked in by the Makefile
+	auto metaRender = KeymapRender{font.data(), font.size(), symkeyMetaMap, PixelFormat::Mono1};
+	auto const metaBin = make_prerendered(metaRender, 0);
+	auto symbolRender = KeymapRender{font.data(), font.size(), parse_symkey_map(path),
+		PixelFormat::Mono1};
+	auto const symbolBin = make_prerendered(symbolRender,
+		fnv1a64(Bench::symbol_keymap.data(), Bench::symbol_keymap.size()));
+
+	if (!same_pixels(Prerendered::get_view(metaBin.data(), metaBin.size()), metaRender)
+	 || !same_pixels(Prerendered::get_view(symbolBin.data(), symbolBin.size()), symbolRender)) {
+		fprintf(stderr, "prerendered mismatch\n");
+		::unlink(path);
+		return 1;
+	}
+
+	auto meta_render = Bench::measure([&]() {
+		auto keymapRender = KeymapRender{font.data(), font.size(), PixelFormat::Mono1};
+		keymapRender.render(symkeyMetaMap);
+		sink = (uintptr_t)keymapRender.get()[0];
+	});
+	auto meta_prerendered = Bench::measure([&]() {
+		auto view = Prerendered::get_view(metaBin.data(), metaBin.size());
+		sink = (uintptr_t)view->pixels;
+	});
+	Bench::report("startup_meta_render", meta_render);
+	Bench::report("startup_meta_prerendered", meta_prerendered);
+	printf("%-32s %12.2fx\n", "speedup", meta_render / meta_prerendered);
+
+	// Symbol path also reads keymap to check it is unchanged since build
+	auto symbol_render = Bench::measure([&]() {
+		auto keymapRender = KeymapRender{font.data(), font.size(), PixelFormat::Mono1};
+		keymapRender.render(parse_symkey_map(path));
+		sink = (uintptr_t)keymapRender.get()[0];
+	});
+	auto symbol_prerendered = Bench::measure([&]() {
+		auto view = Prerendered::get_view(symbolBin.data(), symbolBin.size());
+		auto keymapFile = KeymapFile{path};
+		auto keymapText = keymapFile.get();
+		if (fnv1a64(keymapText.data(), keymapText.size()) == view->keymapHash) {
+			sink = (uintptr_t)view->pixels;
+		}
+	});
+	Bench::report("startup_symbol_render", symbol_render);
+	Bench::report("startup_symbol_prerendered", symbol_prerendered);
+	printf("%-32s %12.2fx\n", "speedup", symbol_render / symbol_prerendered);
+
+	::unlink(path);
+
+	return 0;
+}
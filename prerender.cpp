@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+
+#include "KeymapRender.hpp"
+#include "KeymapFile.hpp"
+#include "Keymaps.hpp"
+#include "Prerendered.hpp"
+#include "fnv1a.hpp"
+
+using namespace std::literals;
+
+// Host tool run at build time: render an overlay to a raw bitmap that
+// the Makefile links into symbol-overlay with objcopy
+
+static auto read_file(char const* path)
+{
+	auto file = ::fopen(path, "rb");
+	if (file == nullptr) {
+		throw std::runtime_error("failed to open "s + path + ": "
+			+ ::strerror(errno));
+	}
+
+	auto result = std::vector<unsigned char>{};
+	unsigned char buf[4096];
+	while (auto size = ::fread(buf, 1, sizeof(buf), file)) {
+		result.insert(result.end(), buf, buf + size);
+	}
+	auto ok = (::ferror(file) == 0);
+	::fclose(file);
+	if (!ok) {
+		throw std::runtime_error("failed to read "s + path);
+	}
+
+	return result;
+}
+
+static void write_bitmap(char const* out_path, Prerendered::Header const& header,
+	unsigned char const* pix, size_t size)
+{
+	auto file = ::fopen(out_path, "wb");
+	if (file == nullptr) {
+		throw std::runtime_error("failed to create "s + out_path + ": "
+			+ ::strerror(errno));
+	}
+
+	auto ok = (::fwrite(&header, sizeof(header), 1, file) == 1)
+		&& ((size == 0) || (::fwrite(pix, 1, size, file) == size));
+	ok = (::fclose(file) == 0) && ok;
+	if (!ok) {
+		throw std::runtime_error("failed to write "s + out_path);
+	}
+}
+
+static auto make_Header(KeymapRender const& keymapRender, uint64_t keymap_hash)
+{
+	auto header = Prerendered::Header{};
+	::memcpy(header.magic, Prerendered::magic, sizeof(Prerendered::magic));
+	header.version = Prerendered::version;
+	header.width = keymapRender.getWidth();
+	header.height = keymapRender.getHeight();
+	header.format = (uint32_t)keymapRender.getFormat();
+	header.keymapHash = keymap_hash;
+	return header;
+}
+
+int main(int argc, char** argv)
+{
+	if ((argc < 4) || (argc > 5)
+	 || ((argv[2] != "meta"sv) && (argv[2] != "symbol"sv))) {
+		fprintf(stderr, "usage: %s font.psf meta <out>\n", argv[0]);
+		fprintf(stderr, "       %s font.psf symbol <out> [keymap]\n", argv[0]);
+		fprintf(stderr, "Without keymap, writes an empty bitmap\n");
+		return 1;
+	}
+	auto const out_path = argv[3];
+
+	try {
+		auto font = read_file(argv[1]);
+		auto keymapRender = KeymapRender{font.data(), font.size(), PixelFormat::Mono1};
+
+		// Meta mode overlay
+		if (argv[2] == "meta"sv) {
+			keymapRender.render(symkeyMetaMap);
+			write_bitmap(out_path, make_Header(keymapRender, 0),
+				keymapRender.get(), keymapRender.getPitch() * keymapRender.getHeight());
+
+		// Symkey overlay for keymap known at build time
+		} else if (argc == 5) {
+			// Hash the same text that is parsed
+			auto keymapFile = KeymapFile{argv[4]};
+			auto keymapText = keymapFile.get();
+			keymapRender.render(resolve_symkey_map(keymapFile.parse()));
+			write_bitmap(out_path,
+				make_Header(keymapRender, fnv1a64(keymapText.data(), keymapText.size())),
+				keymapRender.get(), keymapRender.getPitch() * keymapRender.getHeight());
+
+		// No default keymap, runtime will render
+		} else {
+			auto header = make_Header(keymapRender, 0);
+			header.width = 0;
+			header.height = 0;
+			write_bitmap(out_path, header, nullptr, 0);
+		}
+
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "%s\n", ex.what());
+		return 1;
+	}
+
+	return 0;
+}
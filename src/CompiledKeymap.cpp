@@ -0,0 +1,165 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <string>
+#include <stdexcept>
+
+#include "CompiledKeymap.hpp"
+#include "KeymapFile.hpp"
+#include "fnv1a.hpp"
+
+using namespace std::literals;
+
+static constexpr char compiled_magic[4] = {'S', 'O', 'K', 'M'};
+static constexpr auto compiled_version = uint32_t{3};
+
+std::optional<CompiledKeymap> CompiledKeymap::load(char const* compiled_path)
+{
+	auto fd = ::open(compiled_path, O_RDONLY | O_CLOEXEC);
+	if ((fd < 0) && (errno == ENOENT)) {
+		return std::nullopt;
+	} else if (fd < 0) {
+		throw std::runtime_error("failed to open "s + compiled_path + ": "
+			+ ::strerror(errno));
+	}
+
+	return CompiledKeymap{fd, compiled_path};
+}
+
+CompiledKeymap::CompiledKeymap(int fd, char const* compiled_path)
+	: m_data{nullptr}
+	, m_size{0}
+{
+	struct stat st{};
+	if ((::fstat(fd, &st) < 0) || ((size_t)st.st_size < sizeof(Header))) {
+		::close(fd);
+		throw std::runtime_error("truncated compiled keymap "s + compiled_path);
+	}
+
+	m_size = st.st_size;
+	m_data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (m_data == MAP_FAILED) {
+		m_data = nullptr;
+		throw std::runtime_error("failed to map "s + compiled_path + ": "
+			+ ::strerror(errno));
+	}
+
+	// Validate header and entries. Entry count is checked by division, a
+	// corrupt count can't overflow into a matching size
+	auto const& header = getHeader();
+	auto const entries_size = m_size - sizeof(Header);
+	auto valid = (::memcmp(header.magic, compiled_magic, sizeof(compiled_magic)) == 0)
+		&& (header.version == compiled_version)
+		&& ((entries_size % sizeof(Entry)) == 0)
+		&& (header.numEntries == (entries_size / sizeof(Entry)))
+		&& (header.entriesHash == fnv1a64(begin(), entries_size));
+	if (!valid) {
+		::munmap(m_data, m_size);
+		m_data = nullptr;
+		throw std::runtime_error("invalid compiled keymap "s + compiled_path);
+	}
+}
+
+CompiledKeymap::CompiledKeymap(CompiledKeymap&& expiring)
+	: m_data{expiring.m_data}
+	, m_size{expiring.m_size}
+{
+	expiring.m_data = nullptr;
+	expiring.m_size = 0;
+}
+
+CompiledKeymap::~CompiledKeymap()
+{
+	if (m_data != nullptr) {
+		::munmap(m_data, m_size);
+		m_data = nullptr;
+	}
+}
+
+CompiledKeymap::Header const& CompiledKeymap::getHeader() const
+{
+	return *(Header const*)m_data;
+}
+
+CompiledKeymap::Entry const* CompiledKeymap::begin() const
+{
+	return (Entry const*)((unsigned char const*)m_data + sizeof(Header));
+}
+
+CompiledKeymap::Entry const* CompiledKeymap::end() const
+{
+	return begin() + getHeader().numEntries;
+}
+
+void CompiledKeymap::write(char const* compiled_path, Header header,
+	std::vector<Entry> const& entries)
+{
+	header.numEntries = entries.size();
+	header.entriesHash = fnv1a64(entries.data(), entries.size() * sizeof(Entry));
+
+	auto tmp_path = std::string{compiled_path} + ".tmp";
+	auto file = ::fopen(tmp_path.c_str(), "wb");
+	if (file == nullptr) {
+		throw std::runtime_error("failed to create "s + tmp_path + ": "
+			+ ::strerror(errno));
+	}
+
+	auto ok = (::fwrite(&header, sizeof(header), 1, file) == 1)
+		&& (entries.empty()
+		 || (::fwrite(entries.data(), sizeof(Entry), entries.size(), file) == entries.size()));
+	ok = (::fclose(file) == 0) && ok;
+	if (!ok || (::rename(tmp_path.c_str(), compiled_path) < 0)) {
+		auto err = errno;
+		::unlink(tmp_path.c_str());
+		throw std::runtime_error("failed to write "s + compiled_path + ": "
+			+ ::strerror(err));
+	}
+}
+
+CompiledKeymap::Header CompiledKeymap::make_Header(char const* keymap_path,
+	struct stat const& keymap_st, uint64_t keymap_hash, uint64_t font_hash)
+{
+	auto header = Header{};
+	::memcpy(header.magic, compiled_magic, sizeof(compiled_magic));
+	header.version = compiled_version;
+	header.keymapPathHash = fnv1a64(keymap_path, ::strlen(keymap_path));
+	header.keymapSize = keymap_st.st_size;
+	header.keymapMtimeNs = ((uint64_t)keymap_st.st_mtim.tv_sec * 1000000000)
+		+ keymap_st.st_mtim.tv_nsec;
+	header.keymapInode = keymap_st.st_ino;
+	header.keymapHash = keymap_hash;
+	header.fontHash = font_hash;
+	return header;
+}
+
+bool CompiledKeymap::isCurrent(char const* keymap_path, uint64_t font_hash) const
+{
+	auto const& header = getHeader();
+	if (header.fontHash != font_hash) {
+		return false;
+	}
+
+	// Quick check before reading
+	struct stat keymap_st{};
+	if (::stat(keymap_path, &keymap_st) < 0) {
+		return false;
+	}
+	auto const current = make_Header(keymap_path, keymap_st, 0, 0);
+	if ((header.keymapPathHash != current.keymapPathHash)
+	 || (header.keymapSize != current.keymapSize)
+	 || (header.keymapMtimeNs != current.keymapMtimeNs)
+	 || (header.keymapInode != current.keymapInode)) {
+		return false;
+	}
+
+	// Edits that kept size and modification time
+	auto keymapFile = KeymapFile{keymap_path};
+	auto keymapText = keymapFile.get();
+	return (header.keymapHash == fnv1a64(keymapText.data(), keymapText.size()));
+}
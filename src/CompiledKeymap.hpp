@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+#include <sys/stat.h>
+
+#include <vector>
+#include <optional>
+
+// Versioned binary keymap: keycode, UTF-16 and PSF glyph index per
+// Symbol key, with hashes of the keymap and font it was compiled from.
+// The keymap's size, modification time and inode are kept as a quick
+// check before its contents are hashed
+class CompiledKeymap
+{
+public: // types
+	struct Header
+	{
+		char     magic[4];
+		uint32_t version;
+		uint64_t keymapPathHash;
+		uint64_t keymapSize;
+		uint64_t keymapMtimeNs;
+		uint64_t keymapInode;
+		uint64_t keymapHash;
+		uint64_t fontHash;
+		uint64_t entriesHash;
+		uint32_t numEntries;
+		uint32_t reserved;
+	}__attribute__((packed));
+
+	struct Entry
+	{
+		uint16_t keycode;
+		uint16_t utf16;
+		uint16_t glyph;
+		uint16_t reserved;
+	}__attribute__((packed));
+
+private: // members
+	void* m_data;
+	size_t m_size;
+
+private: // helpers
+	// Map and validate open file, closing it. Throws if corrupt
+	CompiledKeymap(int fd, char const* compiled_path);
+
+public: // interface
+	// Map and validate compiled keymap, nullopt if missing, throws if
+	// unreadable or corrupt
+	static std::optional<CompiledKeymap> load(char const* compiled_path);
+
+	CompiledKeymap(CompiledKeymap&& expiring);
+	~CompiledKeymap();
+
+	Header const& getHeader() const;
+	Entry const* begin() const;
+	Entry const* end() const;
+
+	// Write atomically through a temporary file
+	static void write(char const* compiled_path, Header header,
+		std::vector<Entry> const& entries);
+
+	// Header identifying source keymap and font
+	static Header make_Header(char const* keymap_path, struct stat const& keymap_st,
+		uint64_t keymap_hash, uint64_t font_hash);
+
+	// Compiled from keymap as it is now, for font. Reads the keymap only
+	// if its size, modification time and inode match
+	bool isCurrent(char const* keymap_path, uint64_t font_hash) const;
+};
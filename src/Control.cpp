@@ -0,0 +1,147 @@
+#include <unistd.h>
+#include <fcntl.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/uio.h>
+
+#include <stdexcept>
+
+#include "Control.hpp"
+
+using namespace std::literals;
+
+static auto make_sockaddr(char const* socket_path)
+{
+	auto addr = sockaddr_un{};
+	addr.sun_family = AF_UNIX;
+	if (::strlen(socket_path) >= sizeof(addr.sun_path)) {
+		throw std::runtime_error("socket path too long: "s + socket_path);
+	}
+	::strcpy(addr.sun_path, socket_path);
+	return addr;
+}
+
+Control::Server::Server(char const* socket_path)
+	: m_fd{::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC | SOCK_NONBLOCK, 0)}
+	, m_path{socket_path}
+{
+	if (m_fd < 0) {
+		throw std::runtime_error("failed to create socket: "s + ::strerror(errno));
+	}
+
+	// Replace stale socket from previous instance, but never take over
+	// one a running daemon still accepts on
+	auto addr = make_sockaddr(socket_path);
+	auto probe = ::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+	if (probe < 0) {
+		auto err = errno;
+		::close(m_fd);
+		throw std::runtime_error("failed to create socket: "s + ::strerror(err));
+	}
+	auto connected = (::connect(probe, (sockaddr const*)&addr, sizeof(addr)) == 0);
+	auto err = errno;
+	::close(probe);
+	if (connected || ((err != ECONNREFUSED) && (err != ENOENT))) {
+		::close(m_fd);
+		throw std::runtime_error((connected)
+			? "daemon already running on "s + socket_path
+			: "failed to check "s + socket_path + ": " + ::strerror(err));
+	}
+	if (err == ECONNREFUSED) {
+		::unlink(socket_path);
+	}
+
+	if (::bind(m_fd, (sockaddr const*)&addr, sizeof(addr)) < 0) {
+		auto err = errno;
+		::close(m_fd);
+		throw std::runtime_error("failed to bind "s + socket_path + ": "
+			+ ::strerror(err));
+	}
+
+	if (::listen(m_fd, 8) < 0) {
+		auto err = errno;
+		::close(m_fd);
+		::unlink(socket_path);
+		throw std::runtime_error("failed to listen on "s + socket_path + ": "
+			+ ::strerror(err));
+	}
+}
+
+Control::Server::~Server()
+{
+	if (m_fd >= 0) {
+		::close(m_fd);
+		::unlink(m_path.c_str());
+		m_fd = -1;
+	}
+}
+
+int Control::Server::get()
+{
+	return m_fd;
+}
+
+int Control::Server::accept()
+{
+	return ::accept4(m_fd, nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK);
+}
+
+Control::Client::Client(char const* socket_path)
+	: m_fd{::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0)}
+{
+	if (m_fd < 0) {
+		throw std::runtime_error("failed to create socket: "s + ::strerror(errno));
+	}
+
+	auto addr = make_sockaddr(socket_path);
+	if (::connect(m_fd, (sockaddr const*)&addr, sizeof(addr)) < 0) {
+		auto err = errno;
+		::close(m_fd);
+		throw std::runtime_error("failed to connect to "s + socket_path + ": "
+			+ ::strerror(err));
+	}
+}
+
+Control::Client::~Client()
+{
+	if (m_fd >= 0) {
+		::close(m_fd);
+		m_fd = -1;
+	}
+}
+
+Control::Reply Control::Client::send(Control::Request const& request)
+{
+	return send(request, nullptr, 0);
+}
+
+Control::Reply Control::Client::send(Control::Request const& request,
+	void* payload, size_t payload_size)
+{
+	if (::send(m_fd, &request, sizeof(request), MSG_NOSIGNAL) != sizeof(request)) {
+		throw std::runtime_error("failed to send request: "s + ::strerror(errno));
+	}
+
+	// Reply and payload arrive as one message
+	auto reply = Reply{};
+	iovec iov[] = {{&reply, sizeof(reply)}, {payload, payload_size}};
+	auto msg = msghdr{};
+	msg.msg_iov = iov;
+	msg.msg_iovlen = (payload_size > 0) ? 2 : 1;
+	auto rc = ::recvmsg(m_fd, &msg, 0);
+	if (rc < 0) {
+		throw std::runtime_error("failed to receive reply: "s + ::strerror(errno));
+	}
+	if ((rc < (ssize_t)sizeof(reply)) || (reply.magic != magic) || (reply.version != version)) {
+		throw std::runtime_error("invalid reply from daemon");
+	}
+
+	auto const received = (size_t)rc - sizeof(reply);
+	if (received < payload_size) {
+		::memset((unsigned char*)payload + received, 0, payload_size - received);
+	}
+
+	return reply;
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+
+// Binary protocol spoken over the daemon's Unix control socket.
+// One Request per SOCK_SEQPACKET message, answered by one Reply.
+namespace Control
+{
+
+static constexpr auto magic = uint16_t{0x534f};
+static constexpr auto version = uint8_t{1};
+
+enum class Command : uint8_t
+{
+	Show        = 1, // Show layer, hiding any other visible layer
+	Hide        = 2, // Hide layer
+	Clear       = 3, // Hide all layers
+	Reload      = 4, // Re-render and re-add all layers
+	Highlight   = 5, // Invert keycode's cell on layer, replacing any highlight
+	Unhighlight = 6, // Remove highlight
+	Stats       = 7, // Reply is followed by StatsPayload
+	ResetStats  = 8, // Clear latency histograms
+};
+
+enum class Layer : uint8_t
+{
+	Symbol = 0,
+	Meta   = 1,
+};
+static constexpr auto num_layers = size_t{2};
+
+struct Request
+{
+	uint16_t magic;
+	uint8_t  version;
+	uint8_t  command;
+	uint8_t  layer;
+	uint8_t  keycode; // Highlight only
+	uint8_t  reserved[2];
+}__attribute__((packed));
+
+struct Reply
+{
+	uint16_t magic;
+	uint8_t  version;
+	uint8_t  reserved;
+	int32_t  error; // 0 on success, otherwise errno value
+}__attribute__((packed));
+
+// Latency distributions kept by the daemon, in StatsPayload order
+enum class Latency : uint8_t
+{
+	Command     = 0, // Request received to reply, including driver calls
+	InputShow   = 1, // Input event timestamp to layer shown
+	InputHide   = 2, // Input event timestamp to layer hidden
+	DriverAdd   = 3, // Driver calls, in SharpSession::Call order
+	DriverRemove,
+	DriverShow,
+	DriverHide,
+	DriverClear,
+	DriverDeferRedraw,
+	DriverRedraw,
+};
+static constexpr auto num_latencies = size_t{10};
+static constexpr char const* latency_names[num_latencies] =
+	{ "command", "input_show", "input_hide"
+	, "ov_add", "ov_remove", "ov_show", "ov_hide", "ov_clear", "ov_defer_redraw", "ov_redraw"
+};
+
+struct LatencySummary
+{
+	uint64_t count;
+	uint64_t minNs, p50Ns, p90Ns, p99Ns, maxNs;
+}__attribute__((packed));
+
+struct StatsPayload
+{
+	uint64_t periodNs; // Since start or last reset
+	LatencySummary latencies[num_latencies];
+}__attribute__((packed));
+
+static inline auto make_Request(Command command, Layer layer, uint8_t keycode = 0)
+{
+	return Request{magic, version, (uint8_t)command, (uint8_t)layer, keycode, {}};
+}
+
+static inline auto make_Reply(int32_t error)
+{
+	return Reply{magic, version, 0, error};
+}
+
+// Listening socket owned by the daemon
+class Server
+{
+private: // members
+	int m_fd;
+	std::string m_path;
+
+public: // interface
+	Server(char const* socket_path);
+	~Server();
+
+	int get();
+	int accept();
+};
+
+// Single connection to a running daemon
+class Client
+{
+private: // members
+	int m_fd;
+
+public: // interface
+	Client(char const* socket_path);
+	~Client();
+
+	Reply send(Request const& request);
+
+	// Send request whose reply carries a payload. Missing payload bytes
+	// are zeroed
+	Reply send(Request const& request, void* payload, size_t payload_size);
+};
+
+} // namespace Control
@@ -0,0 +1,672 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/timerfd.h>
+#include <sys/inotify.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "Daemon.hpp"
+#include "Profile.hpp"
+
+using namespace std::literals;
+
+static constexpr auto max_events = 8;
+
+static_assert(Control::num_latencies
+	== (size_t)Control::Latency::DriverAdd + SharpSession::num_calls);
+
+static auto make_LatencySummary(LatencyHistogram const& histogram)
+{
+	return Control::LatencySummary
+		{ .count = histogram.getCount()
+		, .minNs = histogram.getMinNs()
+		, .p50Ns = histogram.getPercentile(0.50)
+		, .p90Ns = histogram.getPercentile(0.90)
+		, .p99Ns = histogram.getPercentile(0.99)
+		, .maxNs = histogram.getMaxNs()
+	};
+}
+
+static auto make_signalfd()
+{
+	// Route termination signals through the event loop
+	auto mask = sigset_t{};
+	::sigemptyset(&mask);
+	::sigaddset(&mask, SIGINT);
+	::sigaddset(&mask, SIGTERM);
+	if (::sigprocmask(SIG_BLOCK, &mask, nullptr) < 0) {
+		throw std::runtime_error("failed to block signals: "s + ::strerror(errno));
+	}
+
+	auto fd = ::signalfd(-1, &mask, SFD_CLOEXEC | SFD_NONBLOCK);
+	if (fd < 0) {
+		throw std::runtime_error("failed to create signalfd: "s + ::strerror(errno));
+	}
+	return fd;
+}
+
+Daemon::Daemon(SharpSession& session, char const* socket_path, RenderFunc&& render)
+	: m_session{session}
+	, m_render{std::move(render)}
+	, m_server{socket_path}
+	, m_epollFd{::epoll_create1(EPOLL_CLOEXEC)}
+	, m_signalFd{-1}
+	, m_overlays{}
+	, m_renders{}
+	, m_highlight{}
+	, m_running{false}
+	, m_input{}
+	, m_inputFds{}
+	, m_keyConfig{}
+	, m_holdFd{-1}
+	, m_heldLayer{}
+	, m_keyLayer{}
+	, m_layerKeysDown{}
+	, m_highlightKeycode{-1}
+	, m_holdDueNs{0}
+	, m_commandLatency{}
+	, m_inputShowLatency{}
+	, m_inputHideLatency{}
+	, m_statsStartNs{KeyInput::now_ns()}
+	, m_inotifyFd{-1}
+	, m_keymapName{}
+{
+	if (m_epollFd < 0) {
+		throw std::runtime_error("failed to create epoll: "s + ::strerror(errno));
+	}
+	m_signalFd = make_signalfd();
+
+	watch(m_server.get());
+	watch(m_signalFd);
+
+	// Render and upload every layer up front
+	auto transaction = OverlayTransaction{m_session};
+	for (size_t i = 0; i < Control::num_layers; i++) {
+		load((Control::Layer)i, transaction);
+	}
+	transaction.commit();
+}
+
+Daemon::~Daemon()
+{
+	auto inputLatency = m_inputShowLatency;
+	inputLatency.merge(m_inputHideLatency);
+	if (m_keyConfig.reportLatency && (inputLatency.getCount() > 0)) {
+		fprintf(stderr, "input: %llu changes, latency min %.3f avg %.3f p99 %.3f max %.3f ms\n",
+			(unsigned long long)inputLatency.getCount(), inputLatency.getMinNs() / 1e6,
+			(inputLatency.getTotalNs() / inputLatency.getCount()) / 1e6,
+			inputLatency.getPercentile(0.99) / 1e6, inputLatency.getMaxNs() / 1e6);
+	}
+
+	// Latencies join --stats report
+	if (Profile::enabled) {
+		Profile::add_latency("command", m_commandLatency);
+		Profile::add_latency("input_show", m_inputShowLatency);
+		Profile::add_latency("input_hide", m_inputHideLatency);
+	}
+
+	// Hide and remove overlays before closing descriptors
+	m_highlight.reset();
+	for (auto& overlay : m_overlays) {
+		overlay.reset();
+	}
+
+	if (m_holdFd >= 0) {
+		::close(m_holdFd);
+		m_holdFd = -1;
+	}
+	if (m_inotifyFd >= 0) {
+		::close(m_inotifyFd);
+		m_inotifyFd = -1;
+	}
+
+	if (m_signalFd >= 0) {
+		::close(m_signalFd);
+		m_signalFd = -1;
+	}
+	if (m_epollFd >= 0) {
+		::close(m_epollFd);
+		m_epollFd = -1;
+	}
+}
+
+void Daemon::watch(int fd)
+{
+	auto event = epoll_event{};
+	event.events = EPOLLIN;
+	event.data.fd = fd;
+	if (::epoll_ctl(m_epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+		throw std::runtime_error("failed to watch descriptor: "s + ::strerror(errno));
+	}
+}
+
+void Daemon::load(Control::Layer layer, OverlayTransaction& transaction)
+{
+	auto& overlay = m_overlays[(size_t)layer];
+	auto const& keymapRender = m_render(layer);
+	m_renders[(size_t)layer] = &keymapRender;
+
+	// Swap in place, keeping visibility across reload
+	if (overlay) {
+		transaction.replace(*overlay, keymapRender.getX(), keymapRender.getY(),
+			keymapRender.getWidth(), keymapRender.getHeight(), keymapRender.get(),
+			keymapRender.getFormat());
+		return;
+	}
+
+	transaction.add(overlay, keymapRender.getX(), keymapRender.getY(),
+		keymapRender.getWidth(), keymapRender.getHeight(), keymapRender.get(),
+		keymapRender.getFormat());
+}
+
+// Highlight goes with any change to the layers under it
+void Daemon::dropHighlight(OverlayTransaction& transaction)
+{
+	if (m_highlight) {
+		transaction.remove(*m_highlight);
+	}
+}
+
+// Upload only the inverted cell, stacked over the shown layer
+int32_t Daemon::highlight(Control::Layer layer, int keycode)
+{
+	auto const& overlay = m_overlays[(size_t)layer];
+	auto const keymapRender = m_renders[(size_t)layer];
+	if (!overlay || !overlay->isShown() || (keymapRender == nullptr)) {
+		return ENOENT;
+	}
+	auto highlight = keymapRender->renderHighlight(keycode);
+	if (!highlight) {
+		return ENOENT;
+	}
+
+	// Swap cells with one redraw
+	if (m_highlight) {
+		auto transaction = OverlayTransaction{m_session};
+		transaction.replace(*m_highlight, highlight->x, highlight->y,
+			highlight->width, highlight->height, highlight->pixels.data(),
+			keymapRender->getFormat());
+		transaction.commit();
+		return 0;
+	}
+
+	m_highlight.emplace(m_session, highlight->x, highlight->y,
+		highlight->width, highlight->height, highlight->pixels.data(),
+		keymapRender->getFormat());
+	m_highlight->show();
+	return 0;
+}
+
+void Daemon::unhighlight()
+{
+	if (m_highlight) {
+		m_highlight->remove();
+		m_highlight.reset();
+	}
+}
+
+void Daemon::showLayer(Control::Layer layer)
+{
+	// Show before hiding so drivers without deferral never blank
+	auto transaction = OverlayTransaction{m_session};
+	dropHighlight(transaction);
+	transaction.show(*m_overlays[(size_t)layer]);
+	for (size_t i = 0; i < Control::num_layers; i++) {
+		if ((i != (size_t)layer) && m_overlays[i] && m_overlays[i]->isShown()) {
+			transaction.hide(*m_overlays[i]);
+		}
+	}
+	transaction.commit();
+	m_highlight.reset();
+}
+
+void Daemon::hideLayer(Control::Layer layer)
+{
+	auto transaction = OverlayTransaction{m_session};
+	dropHighlight(transaction);
+	transaction.hide(*m_overlays[(size_t)layer]);
+	transaction.commit();
+	m_highlight.reset();
+}
+
+// Absolute monotonic time, 0 to disarm
+void Daemon::armHold(uint64_t due_ns)
+{
+	m_holdDueNs = due_ns;
+	auto spec = itimerspec{};
+	spec.it_value.tv_sec = due_ns / 1000000000;
+	spec.it_value.tv_nsec = due_ns % 1000000000;
+	if (::timerfd_settime(m_holdFd, TFD_TIMER_ABSTIME, &spec, nullptr) < 0) {
+		throw std::runtime_error("failed to set hold timer: "s + ::strerror(errno));
+	}
+}
+
+void Daemon::recordLatency(LatencyHistogram& histogram, char const* change,
+	Control::Layer layer, uint64_t since_ns)
+{
+	auto const latency_ns = KeyInput::now_ns() - since_ns;
+	histogram.record(latency_ns);
+
+	if (m_keyConfig.reportLatency) {
+		fprintf(stderr, "input: %s %s %.3f ms\n", change,
+			(layer == Control::Layer::Meta) ? "meta" : "symbol", latency_ns / 1e6);
+	}
+}
+
+void Daemon::handleKey(KeyInput::Event const& event)
+{
+	auto layer = std::optional<Control::Layer>{};
+	for (size_t i = 0; i < Control::num_layers; i++) {
+		if (event.keycode == m_keyConfig.layerKeycodes[i]) {
+			layer = (Control::Layer)i;
+		}
+	}
+
+	// Layer key down shows at once, or after hold time unless released
+	if (layer && (event.value == 1)) {
+		m_layerKeysDown[(size_t)*layer] = true;
+		if (m_keyConfig.holdNs == 0) {
+			showLayer(*layer);
+			m_keyLayer = layer;
+			recordLatency(m_inputShowLatency, "show", *layer, event.timestampNs);
+		} else {
+			m_heldLayer = layer;
+			armHold(event.timestampNs + m_keyConfig.holdNs);
+		}
+
+	// Layer key up cancels a tap or hides. If the other layer key is
+	// still held, its layer comes back in place of this one
+	} else if (layer && (event.value == 0)) {
+		m_layerKeysDown[(size_t)*layer] = false;
+		auto remaining = std::optional<Control::Layer>{};
+		for (size_t i = 0; i < Control::num_layers; i++) {
+			if (m_layerKeysDown[i]) {
+				remaining = (Control::Layer)i;
+			}
+		}
+
+		if (m_heldLayer == layer) {
+			m_heldLayer.reset();
+			armHold(0);
+			if (remaining && !m_keyLayer) {
+				m_heldLayer = remaining;
+				armHold(event.timestampNs + m_keyConfig.holdNs);
+			}
+		}
+		if (m_keyLayer == layer) {
+			if (remaining) {
+				showLayer(*remaining);
+				m_keyLayer = remaining;
+				recordLatency(m_inputShowLatency, "show", *remaining, event.timestampNs);
+			} else {
+				hideLayer(*layer);
+				m_keyLayer.reset();
+				recordLatency(m_inputHideLatency, "hide", *layer, event.timestampNs);
+			}
+		}
+
+	// Other keys flash their cell while a layer is held
+	} else if (m_keyLayer && (event.value == 1)) {
+		if (highlight(*m_keyLayer, event.keycode) == 0) {
+			m_highlightKeycode = event.keycode;
+		}
+
+	} else if (m_highlight && (event.value == 0) && (event.keycode == m_highlightKeycode)) {
+		unhighlight();
+		m_highlightKeycode = -1;
+	}
+}
+
+void Daemon::serviceInput(int fd)
+{
+	// Keep running without a device that went away, leaving nothing
+	// shown for keys it can no longer release
+	auto events = std::vector<KeyInput::Event>{};
+	try {
+		m_input->service(fd, events);
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "input: closing device: %s\n", ex.what());
+		::epoll_ctl(m_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+		m_input->closeFd(fd);
+		m_inputFds = m_input->getFds();
+		releaseKeys();
+		m_session.flushRemovals();
+		return;
+	}
+
+	// Closed descriptors are no longer polled
+	m_inputFds = m_input->getFds();
+
+	for (auto const& event : events) {
+		try {
+			handleKey(event);
+		} catch (std::exception const& ex) {
+			fprintf(stderr, "input: key %d failed: %s\n", event.keycode, ex.what());
+		}
+	}
+	m_session.flushRemovals();
+
+	if (m_input->isDone()) {
+		m_running = false;
+	}
+}
+
+// Forget held keys, hiding what they showed
+void Daemon::releaseKeys()
+{
+	m_layerKeysDown = {};
+	m_highlightKeycode = -1;
+	try {
+		if (m_heldLayer) {
+			m_heldLayer.reset();
+			armHold(0);
+		}
+		if (m_keyLayer) {
+			auto layer = *m_keyLayer;
+			m_keyLayer.reset();
+			hideLayer(layer);
+		} else {
+			unhighlight();
+		}
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "input: release failed: %s\n", ex.what());
+	}
+}
+
+void Daemon::serviceHold()
+{
+	uint64_t expirations;
+	while (::read(m_holdFd, &expirations, sizeof(expirations)) > 0) {
+	}
+	if (!m_heldLayer) {
+		return;
+	}
+
+	auto layer = *m_heldLayer;
+	m_heldLayer.reset();
+	try {
+		showLayer(layer);
+		m_keyLayer = layer;
+		recordLatency(m_inputShowLatency, "show", layer, m_holdDueNs);
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "input: hold failed: %s\n", ex.what());
+	}
+}
+
+void Daemon::serviceKeymapWatch()
+{
+	// Drain events, looking for the keymap by name
+	alignas(inotify_event) char buf[4096];
+	auto changed = false;
+	while (true) {
+		auto rc = ::read(m_inotifyFd, buf, sizeof(buf));
+		if (rc <= 0) {
+			break;
+		}
+		for (auto ptr = buf; ptr < buf + rc; ) {
+			auto const& event = *(inotify_event const*)ptr;
+			if ((event.len > 0) && (m_keymapName == event.name)) {
+				changed = true;
+			}
+			ptr += sizeof(inotify_event) + event.len;
+		}
+	}
+	if (!changed) {
+		return;
+	}
+
+	// Renderer redraws only cells whose mapping changed
+	try {
+		auto transaction = OverlayTransaction{m_session};
+		dropHighlight(transaction);
+		load(Control::Layer::Symbol, transaction);
+		auto const changed_cells = m_renders[(size_t)Control::Layer::Symbol]->getChangedCells();
+		if (changed_cells == 0) {
+			return;
+		}
+		transaction.commit();
+		m_highlight.reset();
+		m_session.flushRemovals();
+		fprintf(stderr, "keymap: %zu cells changed\n", changed_cells);
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "keymap: reload failed: %s\n", ex.what());
+	}
+}
+
+void Daemon::watchKeymap(char const* keymap_path)
+{
+	auto path = std::string{keymap_path};
+	auto slash = path.rfind('/');
+	auto dir = (slash == std::string::npos)
+		? "."s
+		: (slash == 0) ? "/"s : path.substr(0, slash);
+	m_keymapName = (slash == std::string::npos) ? path : path.substr(slash + 1);
+
+	m_inotifyFd = ::inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+	if (m_inotifyFd < 0) {
+		throw std::runtime_error("failed to create inotify: "s + ::strerror(errno));
+	}
+	if (::inotify_add_watch(m_inotifyFd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+		throw std::runtime_error("failed to watch "s + dir + ": " + ::strerror(errno));
+	}
+	watch(m_inotifyFd);
+}
+
+void Daemon::attachInput(std::unique_ptr<KeyInput> input, KeyConfig const& keyConfig)
+{
+	m_holdFd = ::timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+	if (m_holdFd < 0) {
+		throw std::runtime_error("failed to create timerfd: "s + ::strerror(errno));
+	}
+	watch(m_holdFd);
+
+	m_input = std::move(input);
+	m_keyConfig = keyConfig;
+	m_inputFds = m_input->getFds();
+	for (auto fd : m_inputFds) {
+		watch(fd);
+	}
+}
+
+void Daemon::acceptClients()
+{
+	while (true) {
+		auto fd = m_server.accept();
+		if (fd < 0) {
+			if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+				fprintf(stderr, "failed to accept client: %s\n", ::strerror(errno));
+			}
+			return;
+		}
+
+		watch(fd);
+	}
+}
+
+void Daemon::serviceClient(int fd)
+{
+	while (true) {
+		auto request = Control::Request{};
+		auto rc = ::recv(fd, &request, sizeof(request), 0);
+
+		// Drained
+		if ((rc < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK))) {
+			return;
+		}
+
+		// Disconnected or failed
+		if (rc <= 0) {
+			::epoll_ctl(m_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+			::close(fd);
+			return;
+		}
+
+		auto const received_ns = KeyInput::now_ns();
+		auto const valid = (rc == sizeof(request))
+			&& (request.magic == Control::magic)
+			&& (request.version == Control::version);
+		auto const command = (Control::Command)request.command;
+		auto const error = (valid)
+			? handle(request)
+			: int32_t{EINVAL};
+
+		// Overlay commands only, not stats queries
+		if (valid && (command != Control::Command::Stats)
+		 && (command != Control::Command::ResetStats)) {
+			m_commandLatency.record(KeyInput::now_ns() - received_ns);
+		}
+
+		// Stats follow reply in the same message
+		auto reply = Control::make_Reply(error);
+		auto stats = Control::StatsPayload{};
+		iovec iov[] = {{&reply, sizeof(reply)}, {&stats, sizeof(stats)}};
+		auto msg = msghdr{};
+		msg.msg_iov = iov;
+		msg.msg_iovlen = 1;
+		if (valid && (command == Control::Command::Stats) && (error == 0)) {
+			stats = getStats();
+			msg.msg_iovlen = 2;
+		}
+		::sendmsg(fd, &msg, MSG_NOSIGNAL);
+
+		// Free replaced storage after client has its reply
+		m_session.flushRemovals();
+	}
+}
+
+int32_t Daemon::handle(Control::Request const& request)
+{
+	if (request.layer >= Control::num_layers) {
+		return EINVAL;
+	}
+	auto layer = (Control::Layer)request.layer;
+
+	try {
+		switch ((Control::Command)request.command) {
+
+		case Control::Command::Show:
+			showLayer(layer);
+			return 0;
+
+		case Control::Command::Hide:
+			hideLayer(layer);
+			return 0;
+
+		case Control::Command::Clear: {
+			auto transaction = OverlayTransaction{m_session};
+			dropHighlight(transaction);
+			for (auto& overlay : m_overlays) {
+				if (overlay && overlay->isShown()) {
+					transaction.hide(*overlay);
+				}
+			}
+			transaction.commit();
+			m_highlight.reset();
+			return 0;
+		}
+
+		case Control::Command::Reload: {
+			auto transaction = OverlayTransaction{m_session};
+			dropHighlight(transaction);
+			for (size_t i = 0; i < Control::num_layers; i++) {
+				load((Control::Layer)i, transaction);
+			}
+			transaction.commit();
+			m_highlight.reset();
+			return 0;
+		}
+
+		case Control::Command::Highlight:
+			return highlight(layer, request.keycode);
+
+		case Control::Command::Unhighlight:
+			unhighlight();
+			return 0;
+
+		// Reply payload added by caller
+		case Control::Command::Stats:
+			return 0;
+
+		case Control::Command::ResetStats:
+			resetStats();
+			return 0;
+
+		default:
+			return EINVAL;
+		}
+
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "command %u failed: %s\n", request.command, ex.what());
+		return EIO;
+	}
+}
+
+Control::StatsPayload Daemon::getStats() const
+{
+	auto result = Control::StatsPayload{};
+	result.periodNs = KeyInput::now_ns() - m_statsStartNs;
+	result.latencies[(size_t)Control::Latency::Command] = make_LatencySummary(m_commandLatency);
+	result.latencies[(size_t)Control::Latency::InputShow] = make_LatencySummary(m_inputShowLatency);
+	result.latencies[(size_t)Control::Latency::InputHide] = make_LatencySummary(m_inputHideLatency);
+	for (size_t i = 0; i < SharpSession::num_calls; i++) {
+		result.latencies[(size_t)Control::Latency::DriverAdd + i]
+			= make_LatencySummary(m_session.getCallLatency((SharpSession::Call)i));
+	}
+	return result;
+}
+
+void Daemon::resetStats()
+{
+	m_commandLatency.reset();
+	m_inputShowLatency.reset();
+	m_inputHideLatency.reset();
+	m_session.resetCallLatency();
+	m_statsStartNs = KeyInput::now_ns();
+}
+
+void Daemon::run()
+{
+	epoll_event events[max_events];
+
+	m_running = true;
+	while (m_running) {
+		auto num_events = ::epoll_wait(m_epollFd, events, max_events, -1);
+		if (num_events < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			throw std::runtime_error("epoll_wait failed: "s + ::strerror(errno));
+		}
+
+		for (int i = 0; i < num_events; i++) {
+			auto fd = events[i].data.fd;
+
+			if (fd == m_server.get()) {
+				acceptClients();
+
+			} else if (fd == m_signalFd) {
+				m_running = false;
+
+			} else if (fd == m_holdFd) {
+				serviceHold();
+
+			} else if (fd == m_inotifyFd) {
+				serviceKeymapWatch();
+
+			} else if (std::find(m_inputFds.begin(), m_inputFds.end(), fd) != m_inputFds.end()) {
+				serviceInput(fd);
+
+			} else {
+				serviceClient(fd);
+			}
+		}
+	}
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <memory>
+#include <optional>
+#include <functional>
+
+#include "Control.hpp"
+#include "Overlay.hpp"
+#include "KeymapRender.hpp"
+#include "KeyInput.hpp"
+#include "LatencyHistogram.hpp"
+
+// Long-lived process holding every layer pre-added to the driver,
+// so that switching layers costs a single show or hide ioctl
+class Daemon
+{
+public: // types
+	// Returned renderer must stay unchanged until the next call for the
+	// same layer, as highlights are cut from it
+	using RenderFunc = std::function<KeymapRender const&(Control::Layer)>;
+
+	struct KeyConfig
+	{
+		std::array<int, Control::num_layers> layerKeycodes; // Hold to show layer
+		uint64_t holdNs; // Releases sooner change nothing
+		bool reportLatency;
+	};
+
+private: // members
+	SharpSession& m_session;
+	RenderFunc m_render;
+	Control::Server m_server;
+	int m_epollFd, m_signalFd;
+	std::array<std::optional<Overlay>, Control::num_layers> m_overlays;
+	std::array<KeymapRender const*, Control::num_layers> m_renders;
+	std::optional<Overlay> m_highlight; // Stacked over the shown layer
+	bool m_running;
+
+	// Key input
+	std::unique_ptr<KeyInput> m_input;
+	std::vector<int> m_inputFds;
+	KeyConfig m_keyConfig;
+	int m_holdFd;
+	std::optional<Control::Layer> m_heldLayer; // Down, waiting for hold time
+	std::optional<Control::Layer> m_keyLayer; // Shown by key
+	std::array<bool, Control::num_layers> m_layerKeysDown;
+	int m_highlightKeycode;
+	uint64_t m_holdDueNs;
+
+	// Latency to ioctl return from command receipt and from input event,
+	// reported by the Stats command
+	LatencyHistogram m_commandLatency;
+	LatencyHistogram m_inputShowLatency;
+	LatencyHistogram m_inputHideLatency;
+	uint64_t m_statsStartNs;
+
+	// Keymap watch
+	int m_inotifyFd;
+	std::string m_keymapName;
+
+private: // helpers
+	void watch(int fd);
+	void load(Control::Layer layer, OverlayTransaction& transaction);
+	void dropHighlight(OverlayTransaction& transaction);
+	int32_t highlight(Control::Layer layer, int keycode);
+	void unhighlight();
+	void showLayer(Control::Layer layer);
+	void hideLayer(Control::Layer layer);
+	void armHold(uint64_t due_ns);
+	void serviceInput(int fd);
+	void releaseKeys();
+	void serviceHold();
+	void handleKey(KeyInput::Event const& event);
+	void recordLatency(LatencyHistogram& histogram, char const* change, Control::Layer layer,
+		uint64_t since_ns);
+	Control::StatsPayload getStats() const;
+	void resetStats();
+	void serviceKeymapWatch();
+	void acceptClients();
+	void serviceClient(int fd);
+	int32_t handle(Control::Request const& request);
+
+public: // interface
+	Daemon(SharpSession& session, char const* socket_path, RenderFunc&& render);
+	~Daemon();
+
+	// Show layers while their key is held. A text input source stops
+	// the daemon once all of its events are handled
+	void attachInput(std::unique_ptr<KeyInput> input, KeyConfig const& keyConfig);
+
+	// Re-render Symbol layer when keymap file is written or replaced.
+	// Watches the directory, so editors that rename over the file work
+	void watchKeymap(char const* keymap_path);
+
+	void run();
+};
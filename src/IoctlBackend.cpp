@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/ioctl.h>
+
+#include <stdexcept>
+
+#include <libdrm/drm.h>
+#include <libdrm/drm_mode.h>
+
+#include "ioctl_iface.h"
+
+#include "IoctlBackend.hpp"
+
+using namespace std::literals;
+
+static auto overlay_add(int fd, sharp_overlay_t overlay)
+{
+	auto param = sharp_memory_ioctl_ov_add_t { .in_overlay = &overlay };
+	if (auto rc = ::ioctl(fd, DRM_IOCTL_SHARP_OV_ADD, &param)) {
+		throw std::runtime_error(__func__ + " failed: "s + ::strerror(rc));
+	}
+	if ((param.out_storage == NULL)
+	 || ((void*)param.in_overlay == (void*)&param)) {
+		throw std::runtime_error(__func__ + " failed: ioctl returned invalid result"s);
+	}
+	return param.out_storage;
+}
+
+// Returns nullptr if driver does not support formatted overlays
+static auto overlay_add_fmt(int fd, sharp_overlay_fmt_t overlay)
+{
+	auto param = sharp_memory_ioctl_ov_add_fmt_t { .in_overlay = &overlay };
+	if (::ioctl(fd, DRM_IOCTL_SHARP_OV_ADD_FMT, &param) < 0) {
+		if ((errno == EINVAL) || (errno == ENOTTY)) {
+			return (void*)nullptr;
+		}
+		throw std::runtime_error(__func__ + " failed: "s + ::strerror(errno));
+	}
+	if ((param.out_storage == NULL)
+	 || ((void*)param.in_overlay == (void*)&param)) {
+		throw std::runtime_error(__func__ + " failed: ioctl returned invalid result"s);
+	}
+	return param.out_storage;
+}
+
+static void overlay_remove(int fd, void* storage)
+{
+	auto param = sharp_memory_ioctl_ov_rem_t { .storage = storage };
+	if (auto rc = ::ioctl(fd, DRM_IOCTL_SHARP_OV_REM, &param)) {
+		throw std::runtime_error(__func__ + " failed: "s + ::strerror(rc));
+	}
+}
+
+static auto overlay_show(int fd, void *storage)
+{
+	auto param = sharp_memory_ioctl_ov_show_t { .in_storage = storage };
+	if (auto rc = ::ioctl(fd, DRM_IOCTL_SHARP_OV_SHOW, &param)) {
+		throw std::runtime_error(__func__ + " failed: "s + ::strerror(rc));
+	}
+	if ((param.out_display == NULL)
+	 || ((void*)param.out_display == &param)) {
+		throw std::runtime_error(__func__ + " failed: ioctl returned invalid result"s);
+	}
+	return param.out_display;
+}
+
+static void overlay_hide(int fd, void* display)
+{
+	auto param = sharp_memory_ioctl_ov_hide_t { .display = display };
+	if (auto rc = ::ioctl(fd, DRM_IOCTL_SHARP_OV_HIDE, &param)) {
+		throw std::runtime_error(__func__ + " failed: "s + ::strerror(rc));
+	}
+}
+
+// Returns false if driver does not support deferred redraw
+static bool overlay_defer(int fd, bool defer)
+{
+	auto param = sharp_memory_ioctl_ov_defer_t { .defer = (defer) ? 1 : 0 };
+	if (::ioctl(fd, DRM_IOCTL_SHARP_OV_DEFER, &param) < 0) {
+		if ((errno == EINVAL) || (errno == ENOTTY)) {
+			return false;
+		}
+		throw std::runtime_error(__func__ + " failed: "s + ::strerror(errno));
+	}
+	return true;
+}
+
+static void overlay_redraw(int fd)
+{
+	if (auto rc = ::ioctl(fd, DRM_IOCTL_SHARP_REDRAW)) {
+		throw std::runtime_error(__func__ + " failed: "s + ::strerror(rc));
+	}
+}
+
+static void overlay_clear(int fd)
+{
+	if (auto rc = ::ioctl(fd, DRM_IOCTL_SHARP_OV_CLEAR)) {
+		throw std::runtime_error(__func__ + " failed: "s + ::strerror(rc));
+	}
+}
+
+IoctlBackend::IoctlBackend(char const* sharp_dev)
+	: m_fd{::open(sharp_dev, O_RDWR | O_CLOEXEC)}
+{
+	if (m_fd < 0) {
+		throw std::runtime_error("failed to open "s + sharp_dev + ": "
+			+ ::strerror(errno));
+	}
+}
+
+IoctlBackend::~IoctlBackend()
+{
+	if (m_fd >= 0) {
+		::close(m_fd);
+		m_fd = -1;
+	}
+}
+
+void* IoctlBackend::add(int x, int y, size_t width, size_t height,
+	unsigned char const* pix, PixelFormat format)
+{
+	if (format == PixelFormat::Mono1) {
+		return overlay_add_fmt(m_fd, sharp_overlay_fmt_t {
+			.x = x, .y = y, .width = (int)width, .height = (int)height,
+			.format = SHARP_OVERLAY_FMT_MONO1,
+			.pitch = (unsigned int)get_pitch(format, width),
+			.pixels = pix } );
+	}
+
+	return overlay_add(m_fd, sharp_overlay_t {
+		.x = x, .y = y, .width = (int)width, .height = (int)height,
+		.pixels = pix } );
+}
+
+void IoctlBackend::remove(void* storage)
+{
+	overlay_remove(m_fd, storage);
+}
+
+void* IoctlBackend::show(void* storage)
+{
+	return overlay_show(m_fd, storage);
+}
+
+void IoctlBackend::hide(void* display)
+{
+	overlay_hide(m_fd, display);
+}
+
+void IoctlBackend::clear()
+{
+	overlay_clear(m_fd);
+}
+
+bool IoctlBackend::deferRedraw()
+{
+	return overlay_defer(m_fd, true);
+}
+
+void IoctlBackend::redraw()
+{
+	overlay_redraw(m_fd);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "OverlayBackend.hpp"
+
+// Sharp DRM driver overlay ioctls on an open device
+class IoctlBackend : public OverlayBackend
+{
+private: // members
+	int m_fd;
+
+public: // interface
+	IoctlBackend(char const* sharp_dev);
+	IoctlBackend(IoctlBackend const&) = delete;
+	~IoctlBackend();
+
+	void* add(int x, int y, size_t width, size_t height,
+		unsigned char const* pix, PixelFormat format) override;
+	void remove(void* storage) override;
+	void* show(void* storage) override;
+	void hide(void* display) override;
+	void clear() override;
+	bool deferRedraw() override;
+	void redraw() override;
+};
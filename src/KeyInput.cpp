@@ -0,0 +1,246 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <sys/timerfd.h>
+#include <linux/input.h>
+
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+
+#include "KeyInput.hpp"
+
+using namespace std::literals;
+
+static constexpr auto max_evdev_events = 64;
+
+static auto make_timerfd()
+{
+	auto fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+	if (fd < 0) {
+		throw std::runtime_error("failed to create timerfd: "s + ::strerror(errno));
+	}
+	return fd;
+}
+
+uint64_t KeyInput::now_ns()
+{
+	auto ts = timespec{};
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * 1000000000) + ts.tv_nsec;
+}
+
+KeyInput::KeyInput(char const* path)
+	: m_fd{::open(path, O_RDONLY | O_CLOEXEC | O_NONBLOCK)}
+	, m_timerFd{-1}
+	, m_evdev{false}
+	, m_stampOnRead{false}
+	, m_eof{false}
+	, m_partialLine{}
+	, m_queue{}
+	, m_lastDueNs{0}
+{
+	if (m_fd < 0) {
+		throw std::runtime_error("failed to open "s + path + ": "
+			+ ::strerror(errno));
+	}
+
+	struct stat st{};
+	if (::fstat(m_fd, &st) < 0) {
+		auto err = errno;
+		::close(m_fd);
+		throw std::runtime_error("failed to stat "s + path + ": "
+			+ ::strerror(err));
+	}
+
+	// Event timestamps on the same clock as latency measurements
+	if (S_ISCHR(st.st_mode)) {
+		m_evdev = true;
+		auto clock_id = int{CLOCK_MONOTONIC};
+		m_stampOnRead = (::ioctl(m_fd, EVIOCSCLOCKID, &clock_id) < 0);
+		return;
+	}
+
+	try {
+		m_timerFd = make_timerfd();
+	} catch (...) {
+		::close(m_fd);
+		throw;
+	}
+
+	// Regular files cannot be polled, read all events up front
+	if (S_ISREG(st.st_mode)) {
+		readLines();
+		::close(m_fd);
+		m_fd = -1;
+		m_eof = true;
+	}
+}
+
+KeyInput::~KeyInput()
+{
+	if (m_timerFd >= 0) {
+		::close(m_timerFd);
+		m_timerFd = -1;
+	}
+	if (m_fd >= 0) {
+		::close(m_fd);
+		m_fd = -1;
+	}
+}
+
+// Queue complete lines, each due its delay after the previous event
+void KeyInput::readLines()
+{
+	char buf[4096];
+	while (true) {
+		auto rc = ::read(m_fd, buf, sizeof(buf));
+		if (rc < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			if (errno != EAGAIN) {
+				fprintf(stderr, "input: read failed: %s\n", ::strerror(errno));
+				m_eof = true;
+			}
+			break;
+		}
+		if (rc == 0) {
+			m_eof = true;
+			break;
+		}
+		m_partialLine.append(buf, rc);
+	}
+
+	auto const now = now_ns();
+	auto start = size_t{0};
+	for (auto eol = m_partialLine.find('\n'); eol != std::string::npos;
+		eol = m_partialLine.find('\n', start)) {
+
+		auto line = m_partialLine.substr(start, eol - start);
+		start = eol + 1;
+
+		auto delay_ms = 0u;
+		auto event = Event{};
+		if (line.empty() || (line[0] == '#')) {
+			continue;
+		}
+		if (::sscanf(line.c_str(), "%u %d %d", &delay_ms, &event.keycode, &event.value) != 3) {
+			fprintf(stderr, "input: ignoring line: %s\n", line.c_str());
+			continue;
+		}
+
+		m_lastDueNs = std::max(m_lastDueNs, now) + ((uint64_t)delay_ms * 1000000);
+		event.timestampNs = m_lastDueNs;
+		m_queue.push_back(event);
+	}
+	m_partialLine.erase(0, start);
+
+	armTimer();
+}
+
+void KeyInput::readEvdev(std::vector<Event>& events)
+{
+	input_event inputEvents[max_evdev_events];
+	while (true) {
+		auto rc = ::read(m_fd, inputEvents, sizeof(inputEvents));
+		if (rc < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			if (errno == EAGAIN) {
+				return;
+			}
+			throw std::runtime_error("failed to read input: "s + ::strerror(errno));
+		}
+
+		auto const now = now_ns();
+		for (size_t i = 0; i < rc / sizeof(input_event); i++) {
+			auto const& inputEvent = inputEvents[i];
+			if (inputEvent.type != EV_KEY) {
+				continue;
+			}
+			events.push_back(Event
+				{ .keycode = inputEvent.code
+				, .value = inputEvent.value
+				, .timestampNs = (m_stampOnRead)
+					? now
+					: ((uint64_t)inputEvent.input_event_sec * 1000000000)
+						+ ((uint64_t)inputEvent.input_event_usec * 1000)
+			});
+		}
+	}
+}
+
+void KeyInput::armTimer()
+{
+	auto spec = itimerspec{};
+	if (!m_queue.empty()) {
+		auto due = m_queue.front().timestampNs;
+		spec.it_value.tv_sec = due / 1000000000;
+		spec.it_value.tv_nsec = due % 1000000000;
+	}
+	::timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &spec, nullptr);
+}
+
+std::vector<int> KeyInput::getFds() const
+{
+	auto result = std::vector<int>{};
+	if (m_fd >= 0) {
+		result.push_back(m_fd);
+	}
+	if (m_timerFd >= 0) {
+		result.push_back(m_timerFd);
+	}
+	return result;
+}
+
+void KeyInput::service(int fd, std::vector<Event>& events)
+{
+	if (m_evdev) {
+		readEvdev(events);
+		return;
+	}
+
+	// Stop polling closed pipe
+	if (fd == m_fd) {
+		readLines();
+		if (m_eof) {
+			::close(m_fd);
+			m_fd = -1;
+		}
+		return;
+	}
+
+	uint64_t expirations;
+	while (::read(m_timerFd, &expirations, sizeof(expirations)) > 0) {
+	}
+
+	auto const now = now_ns();
+	while (!m_queue.empty() && (m_queue.front().timestampNs <= now)) {
+		events.push_back(m_queue.front());
+		m_queue.pop_front();
+	}
+	armTimer();
+}
+
+void KeyInput::closeFd(int fd)
+{
+	if ((fd >= 0) && (fd == m_fd)) {
+		::close(m_fd);
+		m_fd = -1;
+	} else if ((fd >= 0) && (fd == m_timerFd)) {
+		::close(m_timerFd);
+		m_timerFd = -1;
+	}
+}
+
+bool KeyInput::isDone() const
+{
+	return !m_evdev && m_eof && m_queue.empty();
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+// Key events from an evdev device, or for testing from text lines
+// "<delay_ms> <keycode> <value>" read from a pipe or replay file. Each
+// text event is delivered delay_ms after the one before it
+class KeyInput
+{
+public: // types
+	struct Event
+	{
+		int keycode;
+		int value; // 0 up, 1 down, 2 repeat
+		uint64_t timestampNs; // CLOCK_MONOTONIC
+	};
+
+private: // members
+	int m_fd; // Device or pipe, -1 once a replay file is read
+	int m_timerFd; // Paces text events, -1 for devices
+	bool m_evdev;
+	bool m_stampOnRead; // Device clock could not be set to monotonic
+	bool m_eof;
+	std::string m_partialLine;
+	std::deque<Event> m_queue; // Text events with due times
+	uint64_t m_lastDueNs;
+
+private: // helpers
+	void readLines();
+	void readEvdev(std::vector<Event>& events);
+	void armTimer();
+
+public: // interface
+	// Throws if path cannot be opened
+	KeyInput(char const* path);
+	~KeyInput();
+
+	KeyInput(KeyInput const&) = delete;
+	KeyInput& operator=(KeyInput const&) = delete;
+
+	// Descriptors to wait on for input
+	std::vector<int> getFds() const;
+
+	// Append events now due after fd became readable. Throws if the
+	// device fails, e.g. once unplugged
+	void service(int fd, std::vector<Event>& events);
+
+	// Stop reading a failed descriptor, no longer returned by getFds
+	void closeFd(int fd);
+
+	// Text source has closed and every event was delivered
+	bool isDone() const;
+
+	static uint64_t now_ns();
+};
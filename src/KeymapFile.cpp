@@ -0,0 +1,136 @@
+#include <unistd.h>
+#include <fcntl.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/stat.h>
+
+#include <string>
+#include <charconv>
+#include <stdexcept>
+
+#include "KeymapFile.hpp"
+
+using namespace std::literals;
+
+static auto trim(std::string_view str)
+{
+	auto first = str.find_first_not_of(' ');
+	if (first == std::string_view::npos) {
+		return std::string_view{};
+	}
+	return str.substr(first, str.find_last_not_of(' ') + 1 - first);
+}
+
+KeymapFile::Entries parse_keymap(std::string_view text)
+{
+	auto result = KeymapFile::Entries{};
+
+	//altgr keycode 50 = guillemotright
+	while (!text.empty()) {
+
+		// Split next line
+		auto eol = text.find('\n');
+		auto line = text.substr(0, eol);
+		text.remove_prefix((eol == std::string_view::npos) ? text.size() : eol + 1);
+
+		// Ignore empty or comment lines
+		if (line.empty() || (line[0] == '#')) {
+			continue;
+		}
+
+		// Find altgr modifier lines
+		if (line.compare(0, "altgr "sv.size(), "altgr "sv) != 0) {
+			continue;
+		}
+
+		// Get keycode
+		auto keycode_delim = "keycode "sv;
+		auto keycode_at = line.find(keycode_delim);
+		if (keycode_at == std::string_view::npos) {
+			continue;
+		}
+		auto digits = line.substr(keycode_at + keycode_delim.size());
+		digits.remove_prefix(std::min(digits.find_first_not_of(" \t"), digits.size()));
+		if (!digits.empty() && (digits[0] == '+')) {
+			digits.remove_prefix(1);
+		}
+		auto keycode = int{};
+		auto [end, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), keycode);
+		if (ec != std::errc{}) {
+			throw std::runtime_error("failed to parse line: "s + std::string{line});
+		}
+
+		// Get mapping name
+		auto equals_at = line.find('=');
+		if (equals_at == std::string_view::npos) {
+			continue;
+		}
+		auto mapping = line.substr(equals_at + 1);
+
+		// Trim comments and whitespace
+		mapping = trim(mapping.substr(0, mapping.find('#')));
+
+		result.emplace_back(keycode, mapping);
+	}
+
+	return result;
+}
+
+KeymapFile::KeymapFile(char const* keymap_path)
+	: m_data{}
+	, m_size{0}
+{
+	auto fd = ::open(keymap_path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		throw std::runtime_error("failed to open "s + keymap_path + ": "
+			+ ::strerror(errno));
+	}
+
+	struct stat st{};
+	if (::fstat(fd, &st) < 0) {
+		auto err = errno;
+		::close(fd);
+		throw std::runtime_error("failed to stat "s + keymap_path + ": "
+			+ ::strerror(err));
+	}
+
+	// Size is a hint, read until end of file in case it changed. One
+	// spare byte sees end of file without growing, and the buffer is
+	// left uninitialized as read fills it
+	auto capacity = (st.st_size > 0) ? (size_t)st.st_size + 1 : size_t{4096};
+	m_data.reset(new char[capacity]);
+	while (true) {
+		if (m_size == capacity) {
+			auto grown = std::unique_ptr<char[]>{new char[capacity * 2]};
+			::memcpy(grown.get(), m_data.get(), m_size);
+			m_data = std::move(grown);
+			capacity *= 2;
+		}
+		auto rc = ::read(fd, m_data.get() + m_size, capacity - m_size);
+		if (rc < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			auto err = errno;
+			::close(fd);
+			throw std::runtime_error("failed to read "s + keymap_path + ": "
+				+ ::strerror(err));
+		}
+		if (rc == 0) {
+			break;
+		}
+		m_size += rc;
+	}
+
+	::close(fd);
+}
+
+std::string_view KeymapFile::get() const
+{
+	return std::string_view{m_data.get(), m_size};
+}
+
+KeymapFile::Entries KeymapFile::parse() const
+{
+	return parse_keymap(get());
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Contents of a kbd keymap source file. Read rather than mapped, so the
+// file can be rewritten under --watch while parsed names are in use
+class KeymapFile
+{
+public: // types
+
+	// Keycode and X11 keysym name of each altgr line, in file order.
+	// Names view into the parsed text
+	using Entries = std::vector<std::pair<int, std::string_view>>;
+
+private: // members
+	std::unique_ptr<char[]> m_data;
+	size_t m_size;
+
+public: // interface
+	KeymapFile(char const* keymap_path);
+
+	std::string_view get() const;
+
+	Entries parse() const;
+};
+
+// Parse altgr lines from keymap text without copying
+KeymapFile::Entries parse_keymap(std::string_view text);
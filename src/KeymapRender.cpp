@@ -1,15 +1,20 @@
 #include <string.h>
 
+#include <array>
 #include <string>
 #include <vector>
+#include <algorithm>
 
 #include "KeymapRender.hpp"
+#include "Profile.hpp"
 
 using namespace std::literals;
 
 static constexpr auto fret_height = 4;
+static constexpr auto compact_fret_height = 1;
 static constexpr auto cell_padding = 1;
 static constexpr auto char_padding = 1;
+static constexpr auto cell_width = 40;
 
 static constexpr auto num_rows = 3;
 static constexpr auto num_cols = 10;
@@ -24,31 +29,196 @@ static const auto symkey_alpha_table
 	  , {49, 'N'}, {50, 'M'}, {113, '$'} }
 };
 
-template <typename RenderFunc>
-static void render_map(unsigned char* pix, size_t width, size_t height, size_t cell_width, size_t cell_height,
-	PSF& psf, RenderFunc&& render)
+static constexpr auto all_cells = (uint32_t{1} << (num_rows * num_cols)) - 1;
+
+static constexpr auto max_atlas_cells = size_t{256};
+static constexpr auto max_keycode = 255;
+
+// Reverse of symkey_alpha_table: keycode to cell (row * num_cols) + col, or -1
+static auto make_keycode_cells()
+{
+	auto result = std::array<int8_t, max_keycode + 1>{};
+	result.fill(-1);
+	for (size_t row = 0; row < symkey_alpha_table.size(); row++) {
+		for (size_t col = 0; col < symkey_alpha_table[row].size(); col++) {
+			auto symkey = symkey_alpha_table[row][col].first;
+			if (symkey != 0) {
+				result[symkey] = (row * num_cols) + col;
+			}
+		}
+	}
+	return result;
+}
+
+static const auto keycode_cells = make_keycode_cells();
+
+// Cells whose mapped key differs between keymaps
+static uint32_t get_changed_cells(KeymapRender::Keymap const& from, KeymapRender::Keymap const& to)
+{
+	auto result = uint32_t{0};
+	auto mark = [&result](int symkey) {
+		if ((symkey >= 0) && (symkey <= max_keycode) && (keycode_cells[symkey] >= 0)) {
+			result |= uint32_t{1} << keycode_cells[symkey];
+		}
+	};
+
+	for (auto const& [symkey, utf16] : from) {
+		auto other = to.find(symkey);
+		if ((other == to.end()) || (other->second != utf16)) {
+			mark(symkey);
+		}
+	}
+	for (auto const& [symkey, utf16] : to) {
+		if (from.find(symkey) == from.end()) {
+			mark(symkey);
+		}
+	}
+
+	return result;
+}
+
+static void set_black(unsigned char* pix, size_t pitch, PixelFormat format, size_t x, size_t y)
+{
+	if (format == PixelFormat::Mono1) {
+		pix[(y * pitch) + (x / 8)] |= (0x80 >> (x % 8));
+	} else {
+		pix[(y * pitch) + x] = 0x00;
+	}
+}
+
+// Empty grid: white background, frets and cell padding
+static void render_skeleton(unsigned char* pix, size_t pitch, size_t height,
+	size_t fret_height, size_t cell_width, size_t cell_height, PixelFormat format)
 {
+	auto const white = (format == PixelFormat::Mono1) ? 0x00 : 0xff;
+	auto const black = (format == PixelFormat::Mono1) ? 0xff : 0x00;
+
 	// Set to white background
-	::memset(pix, 0xff, width * height);
+	::memset(pix, white, pitch * height);
 
 	// Render rows
 	for (size_t row = 0; row < num_rows; row++) {
 
 		// Render fret
-		::memset(&pix[(row * cell_height) * width], 0,
-			width * fret_height);
-
-		// Render key contents
-		for (size_t col = 0; col < 10; col++) {
+		::memset(&pix[(row * cell_height) * pitch], black,
+			pitch * fret_height);
 
-			// Render cell padding
+		// Render cell padding
+		for (size_t col = 0; col < num_cols; col++) {
 			for (size_t y = fret_height; y < cell_height; y++) {
 				for (size_t x = 0; x < cell_padding; x++) {
 					auto dx = (col * cell_width) + x;
 					auto dy = (row * cell_height) + y;
-					pix[dy * width + dx] = 0;
+					set_black(pix, pitch, format, dx, dy);
 				}
 			}
+		}
+	}
+}
+
+// Draw mapped and alpha keys into an empty cell-sized bitmap
+static void render_cell(unsigned char* cell, size_t fret_height, size_t cell_width, size_t cell_height,
+	int label_scale, PixelFormat format, PSF& psf, size_t col, int alpha_utf16,
+	KeymapRender::Utf16Triple const& label, uint16_t label_glyph)
+{
+	auto&& [utf16_1, utf16_2, utf16_3] = label;
+
+	auto drawUtf16 = [&](uint16_t utf16, size_t x, size_t y, int scale) {
+		if (format == PixelFormat::Mono1) {
+			psf.drawUtf16Mono(utf16, cell, get_pitch(format, cell_width),
+				cell_width, cell_height, x, y, scale);
+		} else {
+			psf.drawUtf16(utf16, cell, cell_width, cell_height, x, y, scale);
+		}
+	};
+	auto drawGlyph = [&](uint16_t idx, size_t x, size_t y, int scale) {
+		if (format == PixelFormat::Mono1) {
+			psf.drawGlyphMono(idx, cell, get_pitch(format, cell_width),
+				cell_width, cell_height, x, y, scale);
+		} else {
+			psf.drawGlyph(idx, cell, cell_width, cell_height, x, y, scale);
+		}
+	};
+
+	// No second character renders first character large, by glyph index
+	// if known
+	if (utf16_2 == '\0') {
+
+		// Centered, at label scale
+		auto x = (cell_width / 2 - (label_scale * psf.getWidth()) / 2);
+		auto y = fret_height + (cell_height / 2 - (label_scale * psf.getHeight()) / 2);
+		if (label_glyph != PSF::Utf16Table::missing) {
+			drawGlyph(label_glyph, x, y, label_scale);
+		} else {
+			drawUtf16(utf16_1, x, y, label_scale);
+		}
+
+	// Render all
+	} else {
+
+		auto start_at_x = (col < 5)
+			? cell_padding + psf.getWidth() + char_padding
+			: cell_width - (4 * psf.getWidth());
+		auto y = fret_height + (cell_height / 2) - (psf.getHeight() / 2);
+
+		drawUtf16(utf16_1,
+			start_at_x + (0 * psf.getWidth()),
+			y,
+			1);
+		drawUtf16(utf16_2,
+			start_at_x + (1 * psf.getWidth()),
+			y,
+			1);
+		drawUtf16(utf16_3,
+			start_at_x + (2 * psf.getWidth()),
+			y,
+			1);
+	}
+
+	// Render alpha key
+	drawUtf16(alpha_utf16,
+		// Left-align on left half, right-align on right half
+		(col < 5)
+			? cell_padding + char_padding
+			: cell_width - (char_padding + psf.getWidth()),
+		fret_height + char_padding,
+		1);
+}
+
+// Compose dirty cells of overlay from empty grid and atlas of rendered
+// cells. Cells are keyed by position and label, so only new content is
+// drawn. Returns mask of dirty cells drawn, bit (row * num_cols) + col
+template <typename LabelFunc>
+static uint32_t render_map(unsigned char* pix, size_t pitch, size_t height,
+	size_t fret_height, size_t cell_width, size_t cell_height, int label_scale,
+	PixelFormat format, PSF& psf, unsigned char const* skeleton, KeymapRender::CellAtlas& atlas,
+	uint32_t dirty_mask, LabelFunc&& get_label)
+{
+	auto cell_mask = uint32_t{0};
+
+	// Cells start on byte boundaries in both formats
+	auto const cell_pitch = get_pitch(format, cell_width);
+
+	// Clear whole grid, or only the cells being redrawn
+	if (dirty_mask == all_cells) {
+		::memcpy(pix, skeleton, pitch * height);
+	} else {
+		for (size_t cell = 0; cell < num_rows * num_cols; cell++) {
+			if ((dirty_mask & (uint32_t{1} << cell)) == 0) {
+				continue;
+			}
+			auto offset = ((cell / num_cols) * cell_height * pitch) + ((cell % num_cols) * cell_pitch);
+			for (size_t y = 0; y < cell_height; y++) {
+				::memcpy(&pix[offset + (y * pitch)], &skeleton[offset + (y * pitch)], cell_pitch);
+			}
+		}
+	}
+
+	for (size_t row = 0; row < num_rows; row++) {
+		for (size_t col = 0; col < num_cols; col++) {
+			if ((dirty_mask & (uint32_t{1} << ((row * num_cols) + col))) == 0) {
+				continue;
+			}
 
 			// Get alpha / symbol keys
 			if ((symkey_alpha_table.size() <= row)
@@ -60,39 +230,176 @@ static void render_map(unsigned char* pix, size_t width, size_t height, size_t c
 				continue;
 			}
 
-			// Render mapped key, don't render alpha key if no mapped key
-			if (!render(row, col, symkey)) {
+			// Don't render alpha key if no mapped key
+			auto label = KeymapRender::Utf16Triple{};
+			auto label_glyph = PSF::Utf16Table::missing;
+			if (!get_label(symkey, label, label_glyph)) {
 				continue;
 			}
+			auto&& [utf16_1, utf16_2, utf16_3] = label;
+
+			auto cell_origin = &pix[(row * cell_height * pitch) + (col * cell_pitch)];
+
+			// Render cell on first use
+			auto key = ((uint64_t)((row * num_cols) + col) << 48)
+				| ((uint64_t)utf16_1 << 32) | ((uint64_t)utf16_2 << 16) | utf16_3;
+			auto cell = atlas.find(key);
+			if (cell == atlas.end()) {
+				if (atlas.size() >= max_atlas_cells) {
+					atlas.clear();
+				}
+
+				auto pixels = std::vector<unsigned char>(cell_pitch * cell_height);
+				for (size_t y = 0; y < cell_height; y++) {
+					::memcpy(&pixels[y * cell_pitch], cell_origin + (y * pitch), cell_pitch);
+				}
+				render_cell(pixels.data(), fret_height, cell_width, cell_height, label_scale,
+					format, psf, col, alpha_utf16, label, label_glyph);
+
+				cell = atlas.emplace(key, std::move(pixels)).first;
+			}
 
-			// Render alpha key
-			psf.drawUtf16(alpha_utf16,
-				pix, width, height,
-				// Left-align on left half, right-align on right half
-				(col * cell_width) + ((col < 5)
-					? cell_padding + char_padding
-					: cell_width - (char_padding + psf.getWidth())),
-				(row * cell_height) + fret_height + char_padding,
-				1);
+			// Copy cell into place
+			for (size_t y = 0; y < cell_height; y++) {
+				::memcpy(cell_origin + (y * pitch), &cell->second[y * cell_pitch], cell_pitch);
+			}
+			cell_mask |= uint32_t{1} << ((row * num_cols) + col);
 		}
 	}
+
+	return cell_mask;
+}
+
+static auto make_Grid(KeymapRender::Layout layout, PSF& psf)
+{
+	// One line of 1x characters under a thin fret
+	if (layout == KeymapRender::Layout::Compact) {
+		return KeymapRender::Grid
+			{ .fretHeight = compact_fret_height
+			, .cellWidth = cell_width
+			, .cellHeight = compact_fret_height + (2 * char_padding) + psf.getHeight()
+			, .labelScale = 1
+		};
+	}
+
+	return KeymapRender::Grid
+		{ .fretHeight = fret_height
+		, .cellWidth = cell_width
+		, .cellHeight = fret_height + char_padding + 2 * psf.getHeight()
+		, .labelScale = 2
+	};
 }
 
 // Common initialization
-KeymapRender::KeymapRender(unsigned char const* psf_data, size_t psf_size)
+KeymapRender::KeymapRender(unsigned char const* psf_data, size_t psf_size, PixelFormat format,
+	Layout layout)
 	: m_psf{psf_data, psf_size}
-	, m_cellWidth{40}
-	, m_cellHeight{fret_height + char_padding + 2 * m_psf.getHeight()}
-	, m_width{400}
-	, m_height{num_rows * m_cellHeight}
-	, m_pix{new unsigned char[m_width * m_height]}
-{}
-
-KeymapRender::KeymapRender(unsigned char const* psf_data, size_t psf_size, Keymap const& keymap)
-	: KeymapRender(psf_data, psf_size)
+	, m_format{format}
+	, m_layout{layout}
+	, m_grid{make_Grid(layout, m_psf)}
+	, m_gridWidth{num_cols * m_grid.cellWidth}
+	, m_gridHeight{num_rows * m_grid.cellHeight}
+	, m_gridPitch{get_pitch(m_format, m_gridWidth)}
+	, m_x{0}
+	, m_width{m_gridWidth}
+	, m_height{m_gridHeight}
+	, m_pitch{m_gridPitch}
+	, m_cellMask{0}
+	, m_rowMask{(1u << num_rows) - 1}
+	, m_changedCells{0}
+	, m_pix{new unsigned char[m_gridPitch * m_gridHeight]}
+	, m_skeleton(m_gridPitch * m_gridHeight)
+	, m_canvas((layout == Layout::Compact) ? m_gridPitch * m_gridHeight : 0)
+	, m_atlas{}
+	, m_keymap{}
+{
+	auto timer = Profile::Timer{"render_setup"};
+	render_skeleton(m_skeleton.data(), m_gridPitch, m_gridHeight,
+		m_grid.fretHeight, m_grid.cellWidth, m_grid.cellHeight, m_format);
+	::memcpy(m_pix.get(), m_skeleton.data(), m_skeleton.size());
+}
+
+KeymapRender::KeymapRender(unsigned char const* psf_data, size_t psf_size, Keymap const& keymap,
+	PixelFormat format, Layout layout)
+	: KeymapRender(psf_data, psf_size, format, layout)
+{
+	render(keymap);
+}
+
+KeymapRender::KeymapRender(unsigned char const* psf_data, size_t psf_size, KeymapRender::ThreeKeymap const& threeKeymap,
+	PixelFormat format, Layout layout)
+	: KeymapRender(psf_data, psf_size, format, layout)
+{
+	render(threeKeymap);
+}
+
+// Copy rows and column span with drawn cells from canvas to bitmap.
+// Cell columns start on byte boundaries, so Mono1 crops cleanly
+void KeymapRender::crop(uint32_t cell_mask)
+{
+	auto rows = std::vector<size_t>{};
+	auto first_col = size_t{num_cols};
+	auto last_col = size_t{0};
+	for (size_t row = 0; row < num_rows; row++) {
+		auto row_mask = (cell_mask >> (row * num_cols)) & ((1u << num_cols) - 1);
+		if (row_mask == 0) {
+			continue;
+		}
+		rows.push_back(row);
+		for (size_t col = 0; col < num_cols; col++) {
+			if (row_mask & (1u << col)) {
+				first_col = std::min(first_col, col);
+				last_col = std::max(last_col, col);
+			}
+		}
+	}
+
+	// Nothing mapped, show empty grid rather than nothing
+	if (rows.empty()) {
+		rows = {0, 1, 2};
+		first_col = 0;
+		last_col = num_cols - 1;
+	}
+	m_rowMask = 0;
+	for (auto row : rows) {
+		m_rowMask |= 1u << row;
+	}
+
+	m_x = first_col * m_grid.cellWidth;
+	m_width = (last_col + 1 - first_col) * m_grid.cellWidth;
+	m_height = rows.size() * m_grid.cellHeight;
+	m_pitch = get_pitch(m_format, m_width);
+
+	auto const x_offset = get_pitch(m_format, m_x);
+	auto dst = m_pix.get();
+	for (auto row : rows) {
+		for (size_t y = 0; y < m_grid.cellHeight; y++) {
+			::memcpy(dst, &m_canvas[((row * m_grid.cellHeight) + y) * m_gridPitch + x_offset],
+				m_pitch);
+			dst += m_pitch;
+		}
+	}
+}
+
+void KeymapRender::render(Keymap const& keymap, Glyphs const* glyphs)
 {
-	render_map(m_pix.get(), m_width, m_height, m_cellWidth, m_cellHeight, m_psf,
-		[this, &keymap](size_t row, size_t col, int symkey) {
+	auto timer = Profile::Timer{"render"};
+
+	// Redraw only cells whose mapping changed since the last keymap
+	auto const dirty_mask = (m_keymap)
+		? get_changed_cells(*m_keymap, keymap)
+		: all_cells;
+	m_keymap = keymap;
+	m_changedCells = __builtin_popcount(dirty_mask);
+	if (dirty_mask == 0) {
+		return;
+	}
+
+	auto pix = (m_layout == Layout::Compact) ? m_canvas.data() : m_pix.get();
+	auto cell_mask = render_map(pix, m_gridPitch, m_gridHeight,
+		m_grid.fretHeight, m_grid.cellWidth, m_grid.cellHeight, m_grid.labelScale,
+		m_format, m_psf, m_skeleton.data(), m_atlas, dirty_mask,
+		[&keymap, glyphs](int symkey, Utf16Triple& label, uint16_t& label_glyph) {
 
 			// Look up symbol
 			auto symkeyUtf16 = keymap.find(symkey);
@@ -100,25 +407,37 @@ KeymapRender::KeymapRender(unsigned char const* psf_data, size_t psf_size, Keyma
 				return false;
 			}
 
-			// Render mapped key
-			m_psf.drawUtf16(symkeyUtf16->second,
-				m_pix.get(), m_width, m_height,
-				// Centered, 2x scale
-				(col * m_cellWidth) + (m_cellWidth / 2 - m_psf.getWidth()),
-				(row * m_cellHeight) + fret_height
-					+ (m_cellHeight / 2 - m_psf.getHeight()),
-				2);
+			// Render mapped key centered, at label scale
+			label = Utf16Triple{symkeyUtf16->second, '\0', '\0'};
+			if (glyphs != nullptr) {
+				auto symkeyGlyph = glyphs->find(symkey);
+				if (symkeyGlyph != glyphs->end()) {
+					label_glyph = symkeyGlyph->second;
+				}
+			}
 
 			return true;
 		}
 	);
+
+	m_cellMask = (m_cellMask & ~dirty_mask) | cell_mask;
+	if (m_layout == Layout::Compact) {
+		crop(m_cellMask);
+	}
 }
 
-KeymapRender::KeymapRender(unsigned char const* psf_data, size_t psf_size, KeymapRender::ThreeKeymap const& threeKeymap)
-	: KeymapRender(psf_data, psf_size)
+void KeymapRender::render(KeymapRender::ThreeKeymap const& threeKeymap)
 {
-	render_map(m_pix.get(), m_width, m_height, m_cellWidth, m_cellHeight, m_psf,
-		[this, &threeKeymap](size_t row, size_t col, int symkey) {
+	auto timer = Profile::Timer{"render"};
+
+	m_keymap.reset();
+	m_changedCells = num_rows * num_cols;
+
+	auto pix = (m_layout == Layout::Compact) ? m_canvas.data() : m_pix.get();
+	auto cell_mask = render_map(pix, m_gridPitch, m_gridHeight,
+		m_grid.fretHeight, m_grid.cellWidth, m_grid.cellHeight, m_grid.labelScale,
+		m_format, m_psf, m_skeleton.data(), m_atlas, all_cells,
+		[&threeKeymap](int symkey, Utf16Triple& label, uint16_t&) {
 
 			// Look up symbol
 			auto symkeyUtf16Pair = threeKeymap.find(symkey);
@@ -126,52 +445,58 @@ KeymapRender::KeymapRender(unsigned char const* psf_data, size_t psf_size, Keyma
 				return false;
 			}
 
-			// Render mapped keys
-			auto&& [utf16_1, utf16_2, utf16_3] = symkeyUtf16Pair->second;
-
 			// Exit if all empty
+			auto&& [utf16_1, utf16_2, utf16_3] = symkeyUtf16Pair->second;
 			if ((utf16_1 == '\0') && (utf16_2 == '\0') && (utf16_3 == '\0')) {
 				return false;
-
-			// No second character renders first character large
-			} else if (utf16_2 == '\0') {
-
-				m_psf.drawUtf16(utf16_1,
-					m_pix.get(), m_width, m_height,
-					// Centered, 2x scale
-					(col * m_cellWidth) + (m_cellWidth / 2 - m_psf.getWidth()),
-					(row * m_cellHeight) + fret_height
-						+ (m_cellHeight / 2 - m_psf.getHeight()),
-					2);
-
-			// Render all
-			} else {
-
-				auto start_at_x = (col * m_cellWidth) + ((col < 5)
-					? cell_padding + m_psf.getWidth() + char_padding
-					: m_cellWidth - (4 * m_psf.getWidth())
-				);
-				auto y = (row * m_cellHeight) + fret_height
-						+ (m_cellHeight / 2) - (m_psf.getHeight() / 2);
-
-				m_psf.drawUtf16(utf16_1,
-					m_pix.get(), m_width, m_height,
-					start_at_x + (0 * m_psf.getWidth()),
-					y,
-					1);
-				m_psf.drawUtf16(utf16_2,
-					m_pix.get(), m_width, m_height,
-					start_at_x + (1 * m_psf.getWidth()),
-					y,
-					1);
-				m_psf.drawUtf16(utf16_3,
-					m_pix.get(), m_width, m_height,
-					start_at_x + (2 * m_psf.getWidth()),
-					y,
-					1);
 			}
 
+			label = symkeyUtf16Pair->second;
+
 			return true;
 		}
 	);
+
+	m_cellMask = cell_mask;
+	if (m_layout == Layout::Compact) {
+		crop(cell_mask);
+	}
+}
+
+std::optional<KeymapRender::Highlight> KeymapRender::renderHighlight(int keycode) const
+{
+	if ((keycode < 0) || (keycode > max_keycode) || (keycode_cells[keycode] < 0)) {
+		return std::nullopt;
+	}
+	auto const cell = (size_t)keycode_cells[keycode];
+	if ((m_cellMask & (1u << cell)) == 0) {
+		return std::nullopt;
+	}
+	auto const row = cell / num_cols;
+	auto const col = cell % num_cols;
+
+	// Compact bitmaps stack only the rows present
+	auto const bitmap_row = (size_t)__builtin_popcount(m_rowMask & ((1u << row) - 1));
+	auto const cell_x = col * m_grid.cellWidth;
+	auto const cell_pitch = get_pitch(m_format, m_grid.cellWidth);
+	auto const x_offset = get_pitch(m_format, cell_x - m_x);
+
+	auto result = Highlight
+		{ .x = (int)cell_x
+		, .y = getY() + (int)(bitmap_row * m_grid.cellHeight)
+		, .width = m_grid.cellWidth
+		, .height = m_grid.cellHeight
+		, .pixels = std::vector<unsigned char>(cell_pitch * m_grid.cellHeight)
+	};
+
+	// Black and white swap by inverting every bit in both formats
+	for (size_t y = 0; y < m_grid.cellHeight; y++) {
+		auto src = &m_pix[((bitmap_row * m_grid.cellHeight) + y) * m_pitch + x_offset];
+		auto dst = &result.pixels[y * cell_pitch];
+		for (size_t x = 0; x < cell_pitch; x++) {
+			dst[x] = ~src[x];
+		}
+	}
+
+	return result;
 }
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+#include <optional>
 #include <unordered_map>
 
 #include "PSF.hpp"
+#include "PixelFormat.hpp"
 
 class KeymapRender
 {
@@ -12,20 +15,90 @@ public: // types
 	using Utf16Triple = std::tuple<uint16_t, uint16_t, uint16_t>;
 	using ThreeKeymap = std::unordered_map<int, Utf16Triple>;
 
+	// PSF glyph index of each mapped key, resolved ahead of time
+	using Glyphs = std::unordered_map<int, uint16_t>;
+
+	// Rendered cell bitmaps keyed by cell position and label
+	using CellAtlas = std::unordered_map<uint64_t, std::vector<unsigned char>>;
+
+	// Full draws every row at 400 pixels wide. Compact uses thin frets
+	// and single-height cells, and crops to rows and columns with
+	// mapped keys, so fewer panel lines are refreshed
+	enum class Layout
+		{ Full = 0
+		, Compact = 1
+	};
+
+	struct Grid
+	{
+		size_t fretHeight;
+		size_t cellWidth, cellHeight;
+		int labelScale; // Scale of a single mapped character
+	};
+
+	// Inverted copy of one cell, placed over the overlay
+	struct Highlight
+	{
+		int x, y;
+		size_t width, height;
+		std::vector<unsigned char> pixels; // In the overlay's format
+	};
+
+public: // constants
+	// Bump when layout or drawing changes to invalidate cached renders
+	static constexpr auto layout_version = uint32_t{1};
+
 private: // members
 	PSF m_psf;
-	size_t m_cellWidth, m_cellHeight;
-	size_t m_width, m_height;
-	std::unique_ptr<unsigned char> m_pix;
+	PixelFormat m_format;
+	Layout m_layout;
+	Grid m_grid;
+	size_t m_gridWidth, m_gridHeight, m_gridPitch;
+	size_t m_x, m_width, m_height, m_pitch;
+	uint32_t m_cellMask; // Drawn cells, one bit per grid cell in row order
+	uint32_t m_rowMask; // Grid rows present in bitmap
+	size_t m_changedCells;
+	std::unique_ptr<unsigned char[]> m_pix;
+	std::vector<unsigned char> m_skeleton;
+	std::vector<unsigned char> m_canvas; // Uncropped compact render
+	CellAtlas m_atlas;
+	std::optional<Keymap> m_keymap; // Last rendered, to diff the next against
 
 private: // helpers
-	KeymapRender(unsigned char const* psf_data, size_t psf_size);
+	void crop(uint32_t cell_mask);
 
 public: // interface
-	KeymapRender(unsigned char const* psf_data, size_t psf_size, Keymap const& keymap);
-	KeymapRender(unsigned char const* psf_data, size_t psf_size, ThreeKeymap const& threeKeymap);
+	KeymapRender(unsigned char const* psf_data, size_t psf_size,
+		PixelFormat format = PixelFormat::Gray8, Layout layout = Layout::Full);
+	KeymapRender(unsigned char const* psf_data, size_t psf_size, Keymap const& keymap,
+		PixelFormat format = PixelFormat::Gray8, Layout layout = Layout::Full);
+	KeymapRender(unsigned char const* psf_data, size_t psf_size, ThreeKeymap const& threeKeymap,
+		PixelFormat format = PixelFormat::Gray8, Layout layout = Layout::Full);
 
+	// Redraw into the existing bitmap, reusing font state across renders.
+	// A Keymap following another only redraws cells that differ. Glyphs,
+	// if given, skip the font's codepoint lookup for mapped keys
+	void render(Keymap const& keymap, Glyphs const* glyphs = nullptr);
+	void render(ThreeKeymap const& threeKeymap);
+
+	// Cells redrawn by the last render, 0 if the bitmap is unchanged
+	auto getChangedCells() const { return m_changedCells; }
+
+	auto& getPSF() { return m_psf; }
+
+	// Overlay position, bottom-anchored. Compact renders can change
+	// size and position with each keymap
+	auto getX() const { return (int)m_x; }
+	auto getY() const { return -(int)m_height; }
+
+	auto getLayout() const { return m_layout; }
 	auto getWidth() const { return m_width; }
 	auto getHeight() const { return m_height; }
+	auto getPitch() const { return m_pitch; }
+	auto getFormat() const { return m_format; }
 	auto get() const { return m_pix.get(); }
+
+	// Copy and invert the cell drawn for keycode, nullopt if the key
+	// has no cell or nothing was drawn in it
+	std::optional<Highlight> renderHighlight(int keycode) const;
 };
@@ -0,0 +1,62 @@
+#include <stdio.h>
+
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+#include "Keymaps.hpp"
+#include "KeymapFile.hpp"
+#include "Profile.hpp"
+
+// src/x11name_to_utf16.cpp
+extern uint16_t x11name_to_utf16(std::string_view x11name);
+
+static constexpr auto left_arrow = uint16_t{0x2190};
+static constexpr auto right_arrow = uint16_t{0x2192};
+static constexpr auto up_arrow = uint16_t{0x2191};
+static constexpr auto down_arrow = uint16_t{0x2193};
+
+const KeymapRender::ThreeKeymap symkeyMetaMap
+	{ {16, {'W', 'd', left_arrow}}, {17, {left_arrow, '\0', '\0'}}, {18, {up_arrow, '\0', '\0'}}, {19, {'H', 'o', 'm'}}, {20, {'T', 'a', 'b'}}, {21, {}}
+	  , {22, {}}, {23, {}}, {24, {'P', 'g', up_arrow}}, {25, {'P', 'g', down_arrow}}
+	, {30, {'W', 'd', right_arrow}}, {31, {down_arrow, '\0', '\0'}}, {32, {right_arrow, '\0', '\0'}}, {33, {'E', 'n', 'd'}}, {34, {}}, {35, {}}
+	  , {36, {}}, {37, {}}, {38, {}}
+	, { 0, {}}, {44, {}}, {45, {'C', 't', 'l'}}, {46, {'A', 'l', 't'}}, {47, {}}, {48, {}}
+	  , {49, {'K', 'b', down_arrow}}, {50, {'K', 'b', up_arrow}}, {113, {'K', 'b', 't'}}
+};
+
+KeymapRender::Keymap resolve_symkey_map(KeymapFile::Entries const& symkeyX11names)
+{
+	// Build symkey map, later lines override earlier ones
+	auto timer = Profile::Timer{"resolve_keysyms"};
+	auto keymap = KeymapRender::Keymap{};
+	for (auto const& [symkey, x11name] : symkeyX11names) {
+		auto sym_utf16 = x11name_to_utf16(x11name);
+		if (sym_utf16 == 0x0) {
+			keymap.erase(symkey);
+			continue;
+		}
+		keymap[symkey] = sym_utf16;
+	}
+
+	return keymap;
+}
+
+KeymapRender::Keymap parse_symkey_map(std::string const& keymapPath)
+{
+	// Parse keymap, names point into keymap file. Missing or unreadable
+	// keymap shows an empty overlay
+	auto parseTimer = Profile::Timer{"parse_keymap"};
+	auto keymapFile = std::optional<KeymapFile>{};
+	auto symkeyX11names = KeymapFile::Entries{};
+	try {
+		keymapFile.emplace(keymapPath.c_str());
+		symkeyX11names = keymapFile->parse();
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "Failed to read keymap: %s\n", ex.what());
+		return KeymapRender::Keymap{};
+	}
+	parseTimer.stop();
+
+	return resolve_symkey_map(symkeyX11names);
+}
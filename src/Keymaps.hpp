@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string>
+
+#include "KeymapRender.hpp"
+#include "KeymapFile.hpp"
+
+// Built-in Meta mode keymap
+extern const KeymapRender::ThreeKeymap symkeyMetaMap;
+
+// Resolve keysym names of parsed keymap entries
+KeymapRender::Keymap resolve_symkey_map(KeymapFile::Entries const& symkeyX11names);
+
+// Parse text keymap and resolve keysym names
+KeymapRender::Keymap parse_symkey_map(std::string const& keymapPath);
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <array>
+#include <algorithm>
+
+// Fixed-size latency histogram in nanoseconds. Each power of two is
+// split into 8 linear sub-buckets, so any percentile is within 12.5% of
+// the recorded value. Values from 68 s up share the last bucket
+class LatencyHistogram
+{
+public: // constants
+	static constexpr auto sub_bucket_bits = 3;
+	static constexpr auto sub_buckets = size_t{1} << sub_bucket_bits;
+	static constexpr auto max_bits = 36;
+	static constexpr auto num_buckets = (max_bits - sub_bucket_bits + 1) * sub_buckets;
+
+private: // members
+	std::array<uint32_t, num_buckets> m_buckets;
+	uint64_t m_count;
+	uint64_t m_totalNs;
+	uint64_t m_minNs;
+	uint64_t m_maxNs;
+
+private: // helpers
+	static size_t get_bucket(uint64_t ns)
+	{
+		if (ns < sub_buckets) {
+			return ns;
+		}
+		auto const msb = 63 - __builtin_clzll(ns);
+		if (msb >= max_bits) {
+			return num_buckets - 1;
+		}
+		auto const shift = msb - sub_bucket_bits;
+		return ((shift + 1) * sub_buckets) + ((ns >> shift) & (sub_buckets - 1));
+	}
+
+	// Largest value counted in bucket
+	static uint64_t get_bucket_max(size_t bucket)
+	{
+		if (bucket < sub_buckets) {
+			return bucket;
+		}
+		auto const shift = (bucket / sub_buckets) - 1;
+		auto const sub = sub_buckets + (bucket % sub_buckets);
+		return ((sub + 1) << shift) - 1;
+	}
+
+public: // interface
+	LatencyHistogram()
+		: m_buckets{}
+		, m_count{0}
+		, m_totalNs{0}
+		, m_minNs{0}
+		, m_maxNs{0}
+	{}
+
+	void record(uint64_t ns)
+	{
+		m_buckets[get_bucket(ns)]++;
+		m_minNs = (m_count == 0) ? ns : std::min(m_minNs, ns);
+		m_maxNs = std::max(m_maxNs, ns);
+		m_count++;
+		m_totalNs += ns;
+	}
+
+	void merge(LatencyHistogram const& other)
+	{
+		if (other.m_count == 0) {
+			return;
+		}
+		for (size_t i = 0; i < num_buckets; i++) {
+			m_buckets[i] += other.m_buckets[i];
+		}
+		m_minNs = (m_count == 0) ? other.m_minNs : std::min(m_minNs, other.m_minNs);
+		m_maxNs = std::max(m_maxNs, other.m_maxNs);
+		m_count += other.m_count;
+		m_totalNs += other.m_totalNs;
+	}
+
+	void reset()
+	{
+		*this = LatencyHistogram{};
+	}
+
+	// Upper bound of the bucket holding the given fraction of values,
+	// capped at the largest value recorded
+	uint64_t getPercentile(double fraction) const
+	{
+		if (m_count == 0) {
+			return 0;
+		}
+		auto const rank = std::max(uint64_t{1}, (uint64_t)(fraction * m_count + 0.5));
+		auto seen = uint64_t{0};
+		for (size_t i = 0; i < num_buckets; i++) {
+			seen += m_buckets[i];
+			if ((seen >= rank) && (i < num_buckets - 1)) {
+				return std::clamp(get_bucket_max(i), m_minNs, m_maxNs);
+			}
+		}
+		return m_maxNs;
+	}
+
+	uint64_t getCount() const { return m_count; }
+	uint64_t getTotalNs() const { return m_totalNs; }
+	uint64_t getMinNs() const { return m_minNs; }
+	uint64_t getMaxNs() const { return m_maxNs; }
+};
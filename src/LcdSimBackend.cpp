@@ -0,0 +1,176 @@
+#include <stdio.h>
+
+#include "LcdSimBackend.hpp"
+
+// Multi-line update: mode byte, then per line an address byte, the
+// line's pixels at 1bpp and a dummy byte, then a trailing dummy byte
+static constexpr auto mode_bytes = size_t{1};
+static constexpr auto line_overhead_bytes = size_t{2};
+static constexpr auto line_data_bytes = MockBackend::panel_width / 8;
+static constexpr auto trailer_bytes = size_t{1};
+
+// VCOM toggle without update: mode byte and dummy byte
+static constexpr auto vcom_bytes = size_t{2};
+
+// Chip select setup and hold around each transfer
+static constexpr auto scs_overhead_ns = uint64_t{3000 + 1000};
+
+LcdSimBackend::LcdSimBackend(uint32_t spi_hz, uint32_t vcom_hz, FILE* report)
+	: m_mock{""}
+	, m_spiHz{spi_hz}
+	, m_vcomHz{vcom_hz}
+	, m_report{report}
+	, m_storageRows{}
+	, m_displayStorages{}
+	, m_damage(MockBackend::panel_height, false)
+	, m_deferred{false}
+	, m_totals{}
+{}
+
+LcdSimBackend::~LcdSimBackend()
+{
+	if (m_report == nullptr) {
+		return;
+	}
+
+	fprintf(m_report, "lcd: %zu adds uploading %zu bytes\n",
+		m_totals.uploads, m_totals.uploadBytes);
+	fprintf(m_report, "lcd: %zu refreshes, %zu lines, %zu bytes, %.3f ms at %u Hz SPI\n",
+		m_totals.refreshes, m_totals.lines, m_totals.bytes,
+		m_totals.transferNs / 1e6, m_spiHz);
+
+	auto vcom_ns = m_vcomHz * getTransferNs(vcom_bytes);
+	fprintf(m_report, "lcd: VCOM at %u Hz costs %.3f ms per second when idle\n",
+		m_vcomHz, vcom_ns / 1e6);
+}
+
+size_t LcdSimBackend::get_update_bytes(size_t lines)
+{
+	return mode_bytes + (lines * (line_overhead_bytes + line_data_bytes)) + trailer_bytes;
+}
+
+uint64_t LcdSimBackend::getTransferNs(size_t bytes) const
+{
+	return scs_overhead_ns + ((uint64_t)bytes * 8 * 1000000000 / m_spiHz);
+}
+
+void LcdSimBackend::damage(Rows const& rows)
+{
+	for (size_t i = 0; i < rows.count; i++) {
+		auto y = rows.first + (int)i;
+		if ((y >= 0) && (y < (int)m_damage.size())) {
+			m_damage[y] = true;
+		}
+	}
+}
+
+// Send damaged lines to panel unless deferred until redraw
+void LcdSimBackend::flush(char const* op)
+{
+	if (m_deferred) {
+		return;
+	}
+
+	auto lines = size_t{0};
+	for (auto&& dirty : m_damage) {
+		lines += (dirty) ? 1 : 0;
+		dirty = false;
+	}
+	if (lines == 0) {
+		return;
+	}
+
+	auto bytes = get_update_bytes(lines);
+	auto transfer_ns = getTransferNs(bytes);
+	if (m_report != nullptr) {
+		fprintf(m_report, "lcd: %-7s %3zu lines %6zu bytes %8.3f ms\n",
+			op, lines, bytes, transfer_ns / 1e6);
+	}
+
+	m_totals.refreshes++;
+	m_totals.lines += lines;
+	m_totals.bytes += bytes;
+	m_totals.transferNs += transfer_ns;
+}
+
+void* LcdSimBackend::add(int x, int y, size_t width, size_t height,
+	unsigned char const* pix, PixelFormat format)
+{
+	auto storage = m_mock.add(x, y, width, height, pix, format);
+
+	// Negative y from bottom of panel
+	auto first = (y < 0) ? (int)MockBackend::panel_height + y : y;
+	m_storageRows[(uintptr_t)storage] = Rows{first, height};
+
+	m_totals.uploads++;
+	m_totals.uploadBytes += get_pitch(format, width) * height;
+
+	return storage;
+}
+
+void LcdSimBackend::remove(void* storage)
+{
+	m_mock.remove(storage);
+
+	// Removing shown storage hides it
+	for (auto it = m_displayStorages.begin(); it != m_displayStorages.end(); ) {
+		if (it->second == (uintptr_t)storage) {
+			damage(m_storageRows.at(it->second));
+			it = m_displayStorages.erase(it);
+		} else {
+			it++;
+		}
+	}
+	m_storageRows.erase((uintptr_t)storage);
+
+	flush("remove");
+}
+
+void* LcdSimBackend::show(void* storage)
+{
+	auto display = m_mock.show(storage);
+	m_displayStorages[(uintptr_t)display] = (uintptr_t)storage;
+
+	damage(m_storageRows.at((uintptr_t)storage));
+	flush("show");
+
+	return display;
+}
+
+void LcdSimBackend::hide(void* display)
+{
+	m_mock.hide(display);
+
+	auto storage = m_displayStorages.at((uintptr_t)display);
+	m_displayStorages.erase((uintptr_t)display);
+
+	damage(m_storageRows.at(storage));
+	flush("hide");
+}
+
+void LcdSimBackend::clear()
+{
+	m_mock.clear();
+
+	for (auto&& [display, storage] : m_displayStorages) {
+		damage(m_storageRows.at(storage));
+	}
+	m_displayStorages.clear();
+	m_storageRows.clear();
+
+	flush("clear");
+}
+
+bool LcdSimBackend::deferRedraw()
+{
+	m_mock.deferRedraw();
+	m_deferred = true;
+	return true;
+}
+
+void LcdSimBackend::redraw()
+{
+	m_mock.redraw();
+	m_deferred = false;
+	flush("redraw");
+}
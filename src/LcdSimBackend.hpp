@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <map>
+#include <vector>
+
+#include "MockBackend.hpp"
+
+// In-memory driver that estimates what each refresh costs on the
+// Sharp memory LCD: every line an overlay touches is sent over SPI as
+// address, full line of 1bpp data and trailer, regardless of format
+// or overlay width. Reports each refresh and totals to a stream
+class LcdSimBackend : public OverlayBackend
+{
+public: // constants
+	static constexpr auto default_spi_hz = uint32_t{2000000};
+	static constexpr auto default_vcom_hz = uint32_t{1};
+
+public: // types
+	struct Totals
+	{
+		size_t uploads, uploadBytes; // Pixel data copied to driver by adds
+		size_t refreshes, lines, bytes; // Sent to panel
+		uint64_t transferNs;
+	};
+
+private: // types
+	struct Rows
+	{
+		int first;
+		size_t count;
+	};
+
+private: // members
+	MockBackend m_mock;
+	uint32_t m_spiHz, m_vcomHz;
+	FILE* m_report;
+	std::map<uintptr_t, Rows> m_storageRows;
+	std::map<uintptr_t, uintptr_t> m_displayStorages;
+	std::vector<bool> m_damage;
+	bool m_deferred;
+	Totals m_totals;
+
+private: // helpers
+	void damage(Rows const& rows);
+	void flush(char const* op);
+
+public: // interface
+	// Null report stream only keeps totals
+	LcdSimBackend(uint32_t spi_hz, uint32_t vcom_hz, FILE* report = stderr);
+	~LcdSimBackend();
+
+	void* add(int x, int y, size_t width, size_t height,
+		unsigned char const* pix, PixelFormat format) override;
+	void remove(void* storage) override;
+	void* show(void* storage) override;
+	void hide(void* display) override;
+	void clear() override;
+	bool deferRedraw() override;
+	void redraw() override;
+
+	auto const& getTotals() const { return m_totals; }
+
+	// Panel transfer of a multi-line update
+	static size_t get_update_bytes(size_t lines);
+	uint64_t getTransferNs(size_t bytes) const;
+};
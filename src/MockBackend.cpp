@@ -0,0 +1,208 @@
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "MockBackend.hpp"
+
+using namespace std::literals;
+
+static uint64_t now_ns()
+{
+	auto ts = timespec{};
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * 1000000000) + ts.tv_nsec;
+}
+
+MockBackend::MockBackend(char const* dump_path)
+	: m_dumpPath{dump_path}
+	, m_startNs{now_ns()}
+	, m_nextHandle{0x1000}
+	, m_storages{}
+	, m_displays{}
+	, m_deferred{false}
+	, m_refreshes{0}
+	, m_framebuffer(panel_width * panel_height, 0xff)
+	, m_calls{}
+{}
+
+MockBackend::~MockBackend()
+{
+	if (m_dumpPath.empty()) {
+		return;
+	}
+
+	try {
+		dump();
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "Failed to dump mock backend: %s\n", ex.what());
+	}
+}
+
+void MockBackend::record(char const* op, uintptr_t handle)
+{
+	m_calls.push_back(Call{op, now_ns() - m_startNs, handle});
+}
+
+// Panel refreshes on every change unless deferred until redraw
+void MockBackend::refresh()
+{
+	if (!m_deferred) {
+		composite();
+	}
+}
+
+void MockBackend::composite()
+{
+	std::fill(m_framebuffer.begin(), m_framebuffer.end(), 0xff);
+
+	// Later displays drawn over earlier ones, negative y from bottom
+	for (auto&& [display, storage_handle] : m_displays) {
+		auto const& storage = m_storages.at(storage_handle);
+		auto origin_y = (storage.y < 0)
+			? (int)panel_height + storage.y
+			: storage.y;
+
+		for (size_t y = 0; y < storage.height; y++) {
+			auto dy = origin_y + (int)y;
+			if ((dy < 0) || (dy >= (int)panel_height)) {
+				continue;
+			}
+			for (size_t x = 0; x < storage.width; x++) {
+				auto dx = storage.x + (int)x;
+				if ((dx < 0) || (dx >= (int)panel_width)) {
+					continue;
+				}
+				m_framebuffer[(dy * panel_width) + dx]
+					= (storage.pixels[(y * storage.width) + x] == 0x00) ? 0x00 : 0xff;
+			}
+		}
+	}
+
+	m_refreshes++;
+}
+
+void* MockBackend::add(int x, int y, size_t width, size_t height,
+	unsigned char const* pix, PixelFormat format)
+{
+	auto storage = Storage{x, y, width, height, {}};
+	if (format == PixelFormat::Mono1) {
+		storage.pixels = unpack_mono(pix, width, height);
+	} else {
+		storage.pixels.assign(pix, pix + (width * height));
+	}
+
+	auto handle = m_nextHandle;
+	m_nextHandle += 0x10;
+	m_storages.emplace(handle, std::move(storage));
+
+	record("add", handle);
+	return (void*)handle;
+}
+
+void MockBackend::remove(void* storage)
+{
+	record("remove", (uintptr_t)storage);
+	if (m_storages.find((uintptr_t)storage) == m_storages.end()) {
+		throw std::runtime_error("overlay_remove failed: "s + ::strerror(EINVAL));
+	}
+
+	// Removing shown storage hides it
+	auto shown = std::remove_if(m_displays.begin(), m_displays.end(), [storage](auto const& display) {
+		return display.second == (uintptr_t)storage;
+	});
+	auto was_shown = (shown != m_displays.end());
+	m_displays.erase(shown, m_displays.end());
+	m_storages.erase((uintptr_t)storage);
+
+	if (was_shown) {
+		refresh();
+	}
+}
+
+void* MockBackend::show(void* storage)
+{
+	record("show", (uintptr_t)storage);
+	if (m_storages.find((uintptr_t)storage) == m_storages.end()) {
+		throw std::runtime_error("overlay_show failed: "s + ::strerror(EINVAL));
+	}
+
+	auto handle = m_nextHandle;
+	m_nextHandle += 0x10;
+	m_displays.emplace_back(handle, (uintptr_t)storage);
+	refresh();
+
+	return (void*)handle;
+}
+
+void MockBackend::hide(void* display)
+{
+	record("hide", (uintptr_t)display);
+	auto it = std::find_if(m_displays.begin(), m_displays.end(), [display](auto const& entry) {
+		return entry.first == (uintptr_t)display;
+	});
+	if (it == m_displays.end()) {
+		throw std::runtime_error("overlay_hide failed: "s + ::strerror(EINVAL));
+	}
+
+	m_displays.erase(it);
+	refresh();
+}
+
+void MockBackend::clear()
+{
+	record("clear", 0);
+	m_displays.clear();
+	m_storages.clear();
+	refresh();
+}
+
+bool MockBackend::deferRedraw()
+{
+	record("defer", 0);
+	m_deferred = true;
+	return true;
+}
+
+void MockBackend::redraw()
+{
+	record("redraw", 0);
+	m_deferred = false;
+	composite();
+}
+
+void MockBackend::dump() const
+{
+	// Framebuffer as binary PGM
+	auto image = ::fopen(m_dumpPath.c_str(), "wb");
+	if (image == nullptr) {
+		throw std::runtime_error("failed to create "s + m_dumpPath + ": "
+			+ ::strerror(errno));
+	}
+	::fprintf(image, "P5\n%zu %zu\n255\n", panel_width, panel_height);
+	auto ok = (::fwrite(m_framebuffer.data(), 1, m_framebuffer.size(), image)
+		== m_framebuffer.size());
+	ok = (::fclose(image) == 0) && ok;
+	if (!ok) {
+		throw std::runtime_error("failed to write "s + m_dumpPath);
+	}
+
+	// One line per call
+	auto log_path = m_dumpPath + ".log";
+	auto log = ::fopen(log_path.c_str(), "w");
+	if (log == nullptr) {
+		throw std::runtime_error("failed to create "s + log_path + ": "
+			+ ::strerror(errno));
+	}
+	for (auto const& call : m_calls) {
+		::fprintf(log, "%12llu %-7s %#llx\n", (unsigned long long)call.timestampNs,
+			call.op, (unsigned long long)call.handle);
+	}
+	::fprintf(log, "refreshes %zu\n", m_refreshes);
+	if (::fclose(log) != 0) {
+		throw std::runtime_error("failed to write "s + log_path);
+	}
+}
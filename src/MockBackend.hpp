@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "OverlayBackend.hpp"
+
+// In-memory driver for running the show path without a panel. Keeps a
+// composited 8bpp framebuffer and a timestamped log of every call,
+// written out as <dump_path> (PGM) and <dump_path>.log when destroyed
+class MockBackend : public OverlayBackend
+{
+public: // constants
+	static constexpr auto panel_width = size_t{400};
+	static constexpr auto panel_height = size_t{240};
+
+public: // types
+	struct Call
+	{
+		char const* op;
+		uint64_t timestampNs; // Since backend creation
+		uintptr_t handle;
+	};
+
+private: // types
+	struct Storage
+	{
+		int x, y;
+		size_t width, height;
+		std::vector<unsigned char> pixels; // Gray8
+	};
+
+private: // members
+	std::string m_dumpPath;
+	uint64_t m_startNs;
+	uintptr_t m_nextHandle;
+	std::map<uintptr_t, Storage> m_storages;
+	std::vector<std::pair<uintptr_t, uintptr_t>> m_displays; // Display, storage in draw order
+	bool m_deferred;
+	size_t m_refreshes;
+	std::vector<unsigned char> m_framebuffer;
+	std::vector<Call> m_calls;
+
+private: // helpers
+	void record(char const* op, uintptr_t handle);
+	void refresh();
+	void composite();
+
+public: // interface
+	// Empty dump path keeps results in memory only
+	MockBackend(char const* dump_path);
+	MockBackend(MockBackend const&) = delete;
+	~MockBackend();
+
+	void* add(int x, int y, size_t width, size_t height,
+		unsigned char const* pix, PixelFormat format) override;
+	void remove(void* storage) override;
+	void* show(void* storage) override;
+	void hide(void* display) override;
+	void clear() override;
+	bool deferRedraw() override;
+	void redraw() override;
+
+	auto const& getFramebuffer() const { return m_framebuffer; }
+	auto const& getCalls() const { return m_calls; }
+	auto getRefreshes() const { return m_refreshes; }
+
+	void dump() const;
+};
@@ -1,107 +1,237 @@
 #include <stdio.h>
 #include <unistd.h>
 #include <fcntl.h>
-#include <string.h>
-#include <limits.h>
-#include <sys/ioctl.h>
 
+#include <string>
 #include <stdexcept>
-
-#include <libdrm/drm.h>
-#include <libdrm/drm_mode.h>
-
-#include "ioctl_iface.h"
+#include <exception>
 
 #include "Overlay.hpp"
+#include "IoctlBackend.hpp"
+#include "Profile.hpp"
 
 using namespace std::literals;
 
-static auto overlay_add(int fd, sharp_overlay_t overlay)
+static constexpr char const* call_names[SharpSession::num_calls] =
+	{ "ov_add", "ov_remove", "ov_show", "ov_hide", "ov_clear", "ov_defer_redraw", "ov_redraw"
+};
+
+// Records latency of one driver call, between trace markers if enabled
+class SharpSession::CallTimer
 {
-	auto param = sharp_memory_ioctl_ov_add_t { .in_overlay = &overlay };
-	if (auto rc = ::ioctl(fd, DRM_IOCTL_SHARP_OV_ADD, &param)) {
-		throw std::runtime_error(__func__ + " failed: "s + ::strerror(rc));
+private: // members
+	SharpSession& m_session;
+	Call m_call;
+	uint64_t m_startNs;
+
+private: // helpers
+	void mark(std::string const& marker)
+	{
+		::write(m_session.m_traceFd, marker.data(), marker.size());
 	}
-	if ((param.out_storage == NULL)
-	 || ((void*)param.in_overlay == (void*)&param)) {
-		throw std::runtime_error(__func__ + " failed: ioctl returned invalid result"s);
+
+public: // interface
+	CallTimer(SharpSession& session, Call call)
+		: m_session{session}
+		, m_call{call}
+		, m_startNs{}
+	{
+		if (m_session.m_traceFd >= 0) {
+			mark("symbol-overlay: "s + get_call_name(m_call) + " begin\n");
+		}
+		m_startNs = Profile::now_ns();
+	}
+
+	~CallTimer()
+	{
+		auto const ns = Profile::now_ns() - m_startNs;
+		if (m_session.m_traceFd >= 0) {
+			mark("symbol-overlay: "s + get_call_name(m_call) + " end "
+				+ std::to_string(ns) + " ns\n");
+		}
+		m_session.m_callLatency[(size_t)m_call].record(ns);
 	}
-	return param.out_storage;
+
+	CallTimer(CallTimer const&) = delete;
+	CallTimer& operator=(CallTimer const&) = delete;
+};
+
+SharpSession::SharpSession(char const* sharp_dev)
+	: SharpSession(std::make_unique<IoctlBackend>(sharp_dev))
+{}
+
+SharpSession::SharpSession(std::unique_ptr<OverlayBackend> backend)
+	: m_backend{std::move(backend)}
+	, m_monoUnsupported{false}
+	, m_deferUnsupported{false}
+	, m_pendingRemovals{}
+	, m_callLatency{}
+	, m_traceFd{-1}
+{}
+
+SharpSession::SharpSession(SharpSession&& expiring)
+	: m_backend{std::move(expiring.m_backend)}
+	, m_monoUnsupported{expiring.m_monoUnsupported}
+	, m_deferUnsupported{expiring.m_deferUnsupported}
+	, m_pendingRemovals{std::move(expiring.m_pendingRemovals)}
+	, m_callLatency{expiring.m_callLatency}
+	, m_traceFd{expiring.m_traceFd}
+{
+	expiring.m_traceFd = -1;
 }
 
-static void overlay_remove(int fd, void* storage)
+SharpSession::~SharpSession()
 {
-	auto param = sharp_memory_ioctl_ov_rem_t { .storage = storage };
-	if (auto rc = ::ioctl(fd, DRM_IOCTL_SHARP_OV_REM, &param)) {
-		throw std::runtime_error(__func__ + " failed: "s + ::strerror(rc));
+	if (m_backend) {
+		flushRemovals();
+
+		// Call latencies join --stats report
+		if (Profile::enabled) {
+			for (size_t i = 0; i < num_calls; i++) {
+				Profile::add_latency(call_names[i], m_callLatency[i]);
+			}
+		}
+	}
+	if (m_traceFd >= 0) {
+		::close(m_traceFd);
+		m_traceFd = -1;
 	}
 }
 
-static auto overlay_show(int fd, void *storage)
+void* SharpSession::add(int x, int y, size_t width, size_t height,
+	unsigned char const* pix, PixelFormat format)
 {
-	auto param = sharp_memory_ioctl_ov_show_t { .in_storage = storage };
-	if (auto rc = ::ioctl(fd, DRM_IOCTL_SHARP_OV_SHOW, &param)) {
-		throw std::runtime_error(__func__ + " failed: "s + ::strerror(rc));
-	}
-	if ((param.out_display == NULL)
-	 || ((void*)param.out_display == &param)) {
-		throw std::runtime_error(__func__ + " failed: ioctl returned invalid result"s);
+	auto timer = Profile::Timer{"ov_add"};
+
+	if (format == PixelFormat::Mono1) {
+
+		// Packed overlay, remember if driver rejects format
+		if (!m_monoUnsupported) {
+			auto callTimer = CallTimer{*this, Call::Add};
+			if (auto storage = m_backend->add(x, y, width, height, pix, format)) {
+				return storage;
+			}
+			m_monoUnsupported = true;
+		}
+
+		// Fall back to 8bpp
+		auto unpacked = unpack_mono(pix, width, height);
+		auto callTimer = CallTimer{*this, Call::Add};
+		return m_backend->add(x, y, width, height, unpacked.data(), PixelFormat::Gray8);
 	}
-	return param.out_display;
+
+	auto callTimer = CallTimer{*this, Call::Add};
+	return m_backend->add(x, y, width, height, pix, format);
 }
 
-static void overlay_hide(int fd, void* display)
+void SharpSession::remove(void* storage)
 {
-	auto param = sharp_memory_ioctl_ov_hide_t { .display = display };
-	if (auto rc = ::ioctl(fd, DRM_IOCTL_SHARP_OV_HIDE, &param)) {
-		throw std::runtime_error(__func__ + " failed: "s + ::strerror(rc));
+	auto timer = Profile::Timer{"ov_remove"};
+	auto callTimer = CallTimer{*this, Call::Remove};
+	m_backend->remove(storage);
+}
+
+void* SharpSession::show(void* storage)
+{
+	auto timer = Profile::Timer{"ov_show"};
+	auto callTimer = CallTimer{*this, Call::Show};
+	return m_backend->show(storage);
+}
+
+void SharpSession::hide(void* display)
+{
+	auto timer = Profile::Timer{"ov_hide"};
+	auto callTimer = CallTimer{*this, Call::Hide};
+	m_backend->hide(display);
+}
+
+void SharpSession::clear()
+{
+	auto timer = Profile::Timer{"ov_clear"};
+	auto callTimer = CallTimer{*this, Call::Clear};
+	m_backend->clear();
+}
+
+bool SharpSession::deferRedraw()
+{
+	// Remember if driver rejects deferral
+	if (!m_deferUnsupported) {
+		auto callTimer = CallTimer{*this, Call::DeferRedraw};
+		m_deferUnsupported = !m_backend->deferRedraw();
 	}
+	return !m_deferUnsupported;
+}
+
+void SharpSession::redraw()
+{
+	auto timer = Profile::Timer{"ov_redraw"};
+	auto callTimer = CallTimer{*this, Call::Redraw};
+	m_backend->redraw();
 }
 
-static void overlay_clear(int fd)
+void SharpSession::deferRemove(void* storage)
 {
-	if (auto rc = ::ioctl(fd, DRM_IOCTL_SHARP_OV_CLEAR)) {
-		throw std::runtime_error(__func__ + " failed: "s + ::strerror(rc));
+	m_pendingRemovals.push_back(storage);
+}
+
+void SharpSession::flushRemovals()
+{
+	for (auto storage : m_pendingRemovals) {
+		try {
+			auto timer = Profile::Timer{"ov_remove"};
+			auto callTimer = CallTimer{*this, Call::Remove};
+			m_backend->remove(storage);
+		} catch (std::exception const& ex) {
+			fprintf(stderr, "Dropping overlay storage %p: %s\n", storage, ex.what());
+		}
 	}
+	m_pendingRemovals.clear();
 }
 
-SharpSession::SharpSession(char const* sharp_dev)
-	: m_fd{::open(sharp_dev, O_RDWR)}
+bool SharpSession::enableTrace(char const* trace_marker_path)
 {
-	if (m_fd < 0) {
-		throw std::runtime_error("failed to open "s + sharp_dev + ": "
-			+ ::strerror(errno));
+	auto fd = ::open(trace_marker_path, O_WRONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return false;
+	}
+	if (m_traceFd >= 0) {
+		::close(m_traceFd);
 	}
+	m_traceFd = fd;
+	return true;
 }
 
-SharpSession::SharpSession(SharpSession&& expiring)
-	: m_fd{expiring.m_fd}
+LatencyHistogram const& SharpSession::getCallLatency(Call call) const
 {
-	expiring.m_fd = -1;
+	return m_callLatency[(size_t)call];
 }
 
-SharpSession::~SharpSession()
+void SharpSession::resetCallLatency()
 {
-	if (m_fd >= 0) {
-		::close(m_fd);
-		m_fd = -1;
+	for (auto& latency : m_callLatency) {
+		latency.reset();
 	}
 }
 
-int SharpSession::get()
+char const* SharpSession::get_call_name(Call call)
 {
-	return m_fd;
+	return call_names[(size_t)call];
 }
 
 Overlay::Overlay(SharpSession& session,
-	int x, int y, size_t width, size_t height, unsigned char const* pix)
+	int x, int y, size_t width, size_t height, unsigned char const* pix,
+	PixelFormat format)
 	: m_session{session}
-	, m_storage{overlay_add(session.get(), sharp_overlay_t {
-		.x = x, .y = y, .width = (int)width, .height = (int)height,
-		.pixels = pix } )}
+	, m_storage{session.add(x, y, width, height, pix, format)}
 	, m_display{}
 {}
 
+Overlay::Overlay(SharpSession& session, void* storage, void* display)
+	: m_session{session}
+	, m_storage{storage}
+	, m_display{display}
+{}
+
 Overlay::Overlay(Overlay&& expiring)
 	: m_session{expiring.m_session}
 	, m_storage{expiring.m_storage}
@@ -113,39 +243,144 @@ Overlay::Overlay(Overlay&& expiring)
 
 Overlay::~Overlay()
 {
-	if (m_display != nullptr) {
-		hide();
-	}
-
-	if (m_storage != nullptr) {
-		overlay_remove(m_session.get(), m_storage);
-		m_storage = nullptr;
-	}
+	remove();
 }
 
 void Overlay::show()
 {
 	if (m_storage && (m_display == nullptr)) {
-		m_display = overlay_show(m_session.get(), m_storage);
+		m_display = m_session.show(m_storage);
 	}
 }
 
 void Overlay::hide()
 {
 	if (m_display != nullptr) {
-		overlay_hide(m_session.get(), m_display);
+		m_session.hide(m_display);
 		m_display = nullptr;
 	}
 }
 
+void Overlay::replace(int x, int y, size_t width, size_t height, unsigned char const* pix,
+	PixelFormat format)
+{
+	auto storage = m_session.add(x, y, width, height, pix, format);
+
+	// New content visible before old is hidden
+	auto display = (void*)nullptr;
+	if (m_display != nullptr) {
+		try {
+			display = m_session.show(storage);
+		} catch (...) {
+			m_session.remove(storage);
+			throw;
+		}
+	}
+
+	auto old_storage = m_storage;
+	auto old_display = m_display;
+	m_storage = storage;
+	m_display = display;
+
+	if (old_storage != nullptr) {
+		m_session.deferRemove(old_storage);
+	}
+	if (old_display != nullptr) {
+		m_session.hide(old_display);
+	}
+}
+
+void Overlay::remove()
+{
+	hide();
+
+	if (m_storage != nullptr) {
+		m_session.remove(m_storage);
+		m_storage = nullptr;
+	}
+}
+
 void Overlay::eject()
 {
 	m_storage = nullptr;
 	m_display = nullptr;
 }
 
+bool Overlay::isShown() const
+{
+	return m_display != nullptr;
+}
 
 void Overlay::clear_all(SharpSession& session)
 {
-	overlay_clear(session.get());
+	session.clear();
+}
+
+OverlayTransaction::OverlayTransaction(SharpSession& session)
+	: m_session{session}
+	, m_operations{}
+{}
+
+void OverlayTransaction::add(std::optional<Overlay>& overlay,
+	int x, int y, size_t width, size_t height, unsigned char const* pix,
+	PixelFormat format)
+{
+	auto bitmap = std::vector<unsigned char>(pix, pix + (get_pitch(format, width) * height));
+	m_operations.push_back([this, &overlay, x, y, width, height, bitmap = std::move(bitmap), format]() {
+		overlay.emplace(m_session, x, y, width, height, bitmap.data(), format);
+	});
+}
+
+void OverlayTransaction::replace(Overlay& overlay,
+	int x, int y, size_t width, size_t height, unsigned char const* pix,
+	PixelFormat format)
+{
+	auto bitmap = std::vector<unsigned char>(pix, pix + (get_pitch(format, width) * height));
+	m_operations.push_back([&overlay, x, y, width, height, bitmap = std::move(bitmap), format]() {
+		overlay.replace(x, y, width, height, bitmap.data(), format);
+	});
+}
+
+void OverlayTransaction::show(Overlay& overlay)
+{
+	m_operations.push_back([&overlay]() { overlay.show(); });
+}
+
+void OverlayTransaction::hide(Overlay& overlay)
+{
+	m_operations.push_back([&overlay]() { overlay.hide(); });
+}
+
+void OverlayTransaction::remove(Overlay& overlay)
+{
+	m_operations.push_back([&overlay]() { overlay.remove(); });
+}
+
+void OverlayTransaction::commit()
+{
+	auto operations = std::move(m_operations);
+	m_operations.clear();
+
+	// A single change refreshes once by itself
+	auto deferred = (operations.size() > 1) && m_session.deferRedraw();
+
+	auto error = std::exception_ptr{};
+	for (auto& operation : operations) {
+		try {
+			operation();
+		} catch (...) {
+			if (!error) {
+				error = std::current_exception();
+			}
+		}
+	}
+
+	// Single refresh for all changes, also ends deferral
+	if (deferred) {
+		m_session.redraw();
+	}
+
+	if (error) {
+		std::rethrow_exception(error);
+	}
 }
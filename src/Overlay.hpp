@@ -1,18 +1,73 @@
 #pragma once
 
+#include <array>
 #include <memory>
+#include <vector>
+#include <optional>
+#include <functional>
+
+#include "PixelFormat.hpp"
+#include "OverlayBackend.hpp"
+#include "LatencyHistogram.hpp"
 
 class SharpSession
 {
+public: // types
+	// Driver calls, each timed separately
+	enum class Call
+	{
+		Add, Remove, Show, Hide, Clear, DeferRedraw, Redraw,
+	};
+	static constexpr auto num_calls = size_t{7};
+
 private: // members
-	int m_fd;
+	std::unique_ptr<OverlayBackend> m_backend;
+	bool m_monoUnsupported;
+	bool m_deferUnsupported;
+	std::vector<void*> m_pendingRemovals;
+	std::array<LatencyHistogram, num_calls> m_callLatency;
+	int m_traceFd;
+
+private: // helpers
+	class CallTimer;
 
 public: // interface
+	// Driver ioctls on device
 	SharpSession(char const* sharp_dev);
+	SharpSession(std::unique_ptr<OverlayBackend> backend);
 	SharpSession(SharpSession&& expiring);
 	~SharpSession();
 
-	int get();
+	// Add overlay, converting packed bitmaps to 8bpp if the driver
+	// does not accept them. Returns driver storage handle
+	void* add(int x, int y, size_t width, size_t height,
+		unsigned char const* pix, PixelFormat format);
+	void remove(void* storage);
+	void* show(void* storage);
+	void hide(void* display);
+	void clear();
+
+	// Stop overlay changes from refreshing the panel until redraw().
+	// Returns false if the driver does not support deferral
+	bool deferRedraw();
+	void redraw();
+
+	// Queue storage to be freed once off the critical path
+	void deferRemove(void* storage);
+
+	// Free queued storages, reporting and dropping any the driver rejects
+	void flushRemovals();
+
+	// Write a marker to trace_marker before and after each driver call,
+	// to line up with kernel tracing of the driver. Returns false with
+	// errno set if the file cannot be opened
+	bool enableTrace(char const* trace_marker_path);
+
+	// Latency of each call to the driver since creation or reset
+	LatencyHistogram const& getCallLatency(Call call) const;
+	void resetCallLatency();
+
+	static char const* get_call_name(Call call);
 };
 
 class Overlay
@@ -23,13 +78,56 @@ private: // members
 
 public: // interface
 	Overlay(SharpSession& session,
-		int x, int y, size_t width, size_t height, unsigned char const* pix);
+		int x, int y, size_t width, size_t height, unsigned char const* pix,
+		PixelFormat format = PixelFormat::Gray8);
+	// Take ownership of handles from an earlier session
+	Overlay(SharpSession& session, void* storage, void* display);
 	Overlay(Overlay&& expiring);
 	~Overlay();
 
 	void show();
 	void hide();
+
+	// Swap in a new bitmap. The new overlay is added, and shown if this
+	// one is, before the old one is hidden. Old storage is freed by the
+	// session's next flushRemovals
+	void replace(int x, int y, size_t width, size_t height, unsigned char const* pix,
+		PixelFormat format = PixelFormat::Gray8);
+
+	// Hide and free driver storage
+	void remove();
 	void eject();
 
+	bool isShown() const;
+	void* getStorage() const { return m_storage; }
+	void* getDisplay() const { return m_display; }
+
 	static void clear_all(SharpSession& session);
 };
+
+// Overlay changes applied together with one panel refresh. Operations
+// run in queued order on commit; bitmaps are copied when queued
+class OverlayTransaction
+{
+private: // members
+	SharpSession& m_session;
+	std::vector<std::function<void()>> m_operations;
+
+public: // interface
+	OverlayTransaction(SharpSession& session);
+
+	void add(std::optional<Overlay>& overlay,
+		int x, int y, size_t width, size_t height, unsigned char const* pix,
+		PixelFormat format = PixelFormat::Gray8);
+	void replace(Overlay& overlay,
+		int x, int y, size_t width, size_t height, unsigned char const* pix,
+		PixelFormat format = PixelFormat::Gray8);
+	void show(Overlay& overlay);
+	void hide(Overlay& overlay);
+	void remove(Overlay& overlay);
+
+	// Apply every operation with redraws deferred, then redraw once.
+	// Failed operations leave their overlay unchanged; the first
+	// failure is rethrown after the rest have run
+	void commit();
+};
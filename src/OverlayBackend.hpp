@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "PixelFormat.hpp"
+
+// Overlay operations of the Sharp driver, implemented over ioctls or
+// in memory. Storage and display handles are opaque to callers
+class OverlayBackend
+{
+public: // interface
+	virtual ~OverlayBackend() = default;
+
+	// Returns storage handle, nullptr if packed format is not supported.
+	// Gray8 is always supported
+	virtual void* add(int x, int y, size_t width, size_t height,
+		unsigned char const* pix, PixelFormat format) = 0;
+	virtual void remove(void* storage) = 0;
+
+	// Returns display handle
+	virtual void* show(void* storage) = 0;
+	virtual void hide(void* display) = 0;
+
+	// Remove all overlays
+	virtual void clear() = 0;
+
+	// Returns false if redraw deferral is not supported
+	virtual bool deferRedraw() = 0;
+	virtual void redraw() = 0;
+};
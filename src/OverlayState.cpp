@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+
+#include <string>
+#include <stdexcept>
+
+#include "OverlayState.hpp"
+#include "fnv1a.hpp"
+
+using namespace std::literals;
+
+static constexpr char state_magic[4] = {'S', 'O', 'S', 'T'};
+static constexpr auto state_version = uint32_t{1};
+
+static constexpr auto boot_id_path = "/proc/sys/kernel/random/boot_id";
+
+// Procfs reports no size, so read instead of mapping
+static uint64_t get_boot_id_hash()
+{
+	auto fd = ::open(boot_id_path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return 0;
+	}
+	char bootId[64];
+	auto size = ::read(fd, bootId, sizeof(bootId));
+	::close(fd);
+
+	return (size > 0) ? fnv1a64(bootId, size) : 0;
+}
+
+// Device node is recreated with new times when the driver is reloaded
+static uint64_t get_device_hash(char const* sharp_dev)
+{
+	struct stat st{};
+	if (::stat(sharp_dev, &st) < 0) {
+		throw std::runtime_error("failed to stat "s + sharp_dev + ": "
+			+ ::strerror(errno));
+	}
+
+	uint64_t const fields[] = {(uint64_t)st.st_rdev, (uint64_t)st.st_ino,
+		(uint64_t)st.st_ctim.tv_sec, (uint64_t)st.st_ctim.tv_nsec};
+	return fnv1a64(fields, sizeof(fields));
+}
+
+static auto make_Header(uint64_t boot_id_hash, uint64_t device_hash)
+{
+	auto header = OverlayState::Header{};
+	::memcpy(header.magic, state_magic, sizeof(state_magic));
+	header.version = state_version;
+	header.bootIdHash = boot_id_hash;
+	header.deviceHash = device_hash;
+	return header;
+}
+
+OverlayState::OverlayState(char const* state_path, char const* sharp_dev)
+	: m_fd{::open(state_path, O_RDWR | O_CREAT | O_CLOEXEC, 0600)}
+	, m_header{}
+{
+	if (m_fd < 0) {
+		throw std::runtime_error("failed to open "s + state_path + ": "
+			+ ::strerror(errno));
+	}
+
+	// Serialize invocations, released on close
+	if (::flock(m_fd, LOCK_EX) < 0) {
+		auto err = errno;
+		::close(m_fd);
+		throw std::runtime_error("failed to lock "s + state_path + ": "
+			+ ::strerror(err));
+	}
+
+	auto current = make_Header(get_boot_id_hash(), get_device_hash(sharp_dev));
+
+	// Keep stored handles only if they refer to this driver instance
+	auto stored = Header{};
+	auto valid = (::pread(m_fd, &stored, sizeof(stored), 0) == sizeof(stored))
+		&& (::memcmp(stored.magic, current.magic, sizeof(current.magic)) == 0)
+		&& (stored.version == current.version)
+		&& (stored.bootIdHash == current.bootIdHash)
+		&& (stored.deviceHash == current.deviceHash);
+	m_header = (valid) ? stored : current;
+}
+
+OverlayState::OverlayState(OverlayState&& expiring)
+	: m_fd{expiring.m_fd}
+	, m_header{expiring.m_header}
+{
+	expiring.m_fd = -1;
+}
+
+OverlayState::~OverlayState()
+{
+	if (m_fd >= 0) {
+		::close(m_fd);
+		m_fd = -1;
+	}
+}
+
+OverlayState::Entry& OverlayState::get(Control::Layer layer)
+{
+	return m_header.entries[(size_t)layer];
+}
+
+void OverlayState::reset()
+{
+	for (auto& entry : m_header.entries) {
+		entry = Entry{};
+	}
+}
+
+void OverlayState::save()
+{
+	if ((::pwrite(m_fd, &m_header, sizeof(m_header), 0) != sizeof(m_header))
+	 || (::ftruncate(m_fd, sizeof(m_header)) < 0)) {
+		throw std::runtime_error("failed to write overlay state: "s + ::strerror(errno));
+	}
+}
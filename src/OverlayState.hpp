@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Control.hpp"
+
+// Driver handles of overlays left on screen by one-shot invocations,
+// kept in a small locked file under /run so later runs can hide,
+// re-show or remove them instead of leaking storage
+class OverlayState
+{
+public: // types
+	struct Entry
+	{
+		uint64_t contentHash;
+		uint64_t storage; // 0 if no overlay added
+		uint64_t display; // 0 if not shown
+	}__attribute__((packed));
+
+	struct Header
+	{
+		char     magic[4];
+		uint32_t version;
+		uint64_t bootIdHash; // Handles are meaningless after reboot
+		uint64_t deviceHash; // or once the driver recreates the device
+		Entry    entries[Control::num_layers];
+	}__attribute__((packed));
+
+private: // members
+	int m_fd;
+	Header m_header;
+
+public: // interface
+	// Open and lock state file until destroyed. State from another boot
+	// or device instance is discarded
+	OverlayState(char const* state_path, char const* sharp_dev);
+	OverlayState(OverlayState&& expiring);
+	~OverlayState();
+
+	Entry& get(Control::Layer layer);
+
+	// Forget all handles, after the driver cleared its overlays
+	void reset();
+
+	void save();
+};
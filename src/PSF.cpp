@@ -4,9 +4,11 @@
 
 #include <memory>
 #include <string>
+#include <algorithm>
 #include <stdexcept>
 
 #include "PSF.hpp"
+#include "Profile.hpp"
 
 using namespace std::literals;
 
@@ -14,6 +16,8 @@ static constexpr auto psf1_magic = 0x0436;
 static constexpr auto psf1_charwidth = 8;
 static constexpr auto unicode_table_offs = 0x2000;
 static constexpr auto unicode_table_delim = 0xffff;
+static constexpr auto max_glyphs = 0x200;
+static constexpr auto cache_index_empty = uint16_t{0xffff};
 
 /*
 00002000: 0000 0000 a900 ffff 2601 ffff 3501 ffff  ........&...5...
@@ -26,10 +30,96 @@ static constexpr auto unicode_table_delim = 0xffff;
 0004 <- 2666, 25c8, fffd
 */
 
+static constexpr auto page_size = size_t{256};
+
+// Each glyph row byte expanded to 8 pixels at given scale, black on white
+template <int Scale>
+struct RowTable
+{
+	unsigned char rows[256][psf1_charwidth * Scale];
+};
+template <int Scale>
+static constexpr auto make_RowTable()
+{
+	auto result = RowTable<Scale>{};
+	for (int bits = 0; bits < 256; bits++) {
+		for (int dx = 0; dx < psf1_charwidth * Scale; dx++) {
+			result.rows[bits][dx] = ((bits >> (7 - (dx / Scale))) & 1) ? 0x00 : 0xff;
+		}
+	}
+	return result;
+}
+static constexpr auto row_table = make_RowTable<1>();
+static constexpr auto row_table_x2 = make_RowTable<2>();
+
+// Copy expanded row, constant size when unclipped
+template <int Width>
+static inline void copy_row(unsigned char* dest, unsigned char const* src, int dest_width)
+{
+	if (dest_width == Width) {
+		::memcpy(dest, src, Width);
+	} else {
+		::memcpy(dest, src, dest_width);
+	}
+}
+
+// Blit clipped glyph rectangle one destination row at a time.
+// Scale of 0 selects the runtime-scale path
+template <int Scale>
+static void blit_glyph(unsigned char const* glyph, unsigned char* dest, int pitch,
+	int dest_width, int dest_height, int runtime_scale)
+{
+	auto const scale = (Scale > 0) ? Scale : runtime_scale;
+
+	for (int dy = 0; dy < dest_height; dy += scale) {
+		auto const bits = glyph[dy / scale];
+		auto* first = dest + (dy * pitch);
+
+		// Expand glyph row into each destination row of the scaled block
+		if constexpr (Scale == 1) {
+			copy_row<psf1_charwidth>(first, row_table.rows[bits], dest_width);
+
+		} else if constexpr (Scale == 2) {
+			auto const* line = row_table_x2.rows[bits];
+			copy_row<psf1_charwidth * 2>(first, line, dest_width);
+			if (dy + 1 < dest_height) {
+				copy_row<psf1_charwidth * 2>(first + pitch, line, dest_width);
+			}
+
+		} else {
+			auto const* src = row_table.rows[bits];
+			for (int dx = 0, sx = 0; dx < dest_width; dx += scale, sx++) {
+				::memset(first + dx, src[sx], std::min(scale, dest_width - dx));
+			}
+			auto block_rows = std::min(scale, dest_height - dy);
+			for (int row = 1; row < block_rows; row++) {
+				::memcpy(first + (row * pitch), first, dest_width);
+			}
+		}
+	}
+}
+
+PSF::Utf16Table::Utf16Table()
+	: m_directory{}
+	, m_pages(page_size, missing)
+{}
+
+void PSF::Utf16Table::set(uint16_t utf16, uint16_t glyph)
+{
+	// Allocate page on first mapping in its range
+	auto& page = m_directory[utf16 >> 8];
+	if (page == 0) {
+		page = m_pages.size() / page_size;
+		m_pages.resize(m_pages.size() + page_size, missing);
+	}
+
+	m_pages[(page << 8) | (utf16 & 0xff)] = glyph;
+}
+
 static PSF::Utf16Table
 gen_psf1_utf16_table(unsigned char const* psf_data, size_t psf_size)
 {
-	auto result = std::unordered_map<uint16_t, uint16_t>{};
+	auto result = PSF::Utf16Table{};
 
 	// Read entries
 	auto psf_idx = uint16_t{0};
@@ -40,7 +130,7 @@ gen_psf1_utf16_table(unsigned char const* psf_data, size_t psf_size)
 		if (unicode_val == unicode_table_delim) {
 			psf_idx++;
 		} else {
-			result[unicode_val] = psf_idx;
+			result.set(unicode_val, psf_idx);
 		}
 		ptr += sizeof(uint16_t);
 	}
@@ -53,6 +143,11 @@ PSF::PSF(unsigned char const* psf_data, size_t psf_size)
 	, m_psfSize{psf_size}
 	, m_table{}
 	, m_header{*(psf1_header const*)m_psfData}
+	, m_cacheIndex{}
+	, m_cache{}
+	, m_cacheCapacity{0}
+	, m_cacheClock{0}
+	, m_cacheStats{}
 {
 	// Validate header
 	if (m_header.magic != psf1_magic) {
@@ -63,6 +158,7 @@ PSF::PSF(unsigned char const* psf_data, size_t psf_size)
 	}
 
 	// Read UTF16 translation table
+	auto timer = Profile::Timer{"psf_table"};
 	m_table = gen_psf1_utf16_table(m_psfData, m_psfSize);
 }
 
@@ -76,19 +172,94 @@ size_t PSF::getWidth()
 	return psf1_charwidth;
 }
 
-void PSF::drawUtf16(uint16_t utf16,
-	unsigned char *buf, int buf_width, int buf_height,
-	int x, int y, int scale)
+uint16_t PSF::getGlyphIndex(uint16_t utf16) const
 {
-	// Map UTF16 to PSF index
-	auto utf16Psfindex = m_table.find(utf16);
-	if (utf16Psfindex == m_table.end()) {
-		return;
+	return m_table.find(utf16);
+}
+
+void PSF::enableGlyphCache(size_t max_glyphs)
+{
+	m_cacheCapacity = std::min(max_glyphs, (size_t)cache_index_empty);
+	m_cache.clear();
+	m_cache.reserve(m_cacheCapacity);
+	m_cacheIndex.assign((m_cacheCapacity > 0)
+		? ::max_glyphs * max_cached_scale
+		: 0,
+		cache_index_empty);
+}
+
+PSF::CacheStats PSF::getCacheStats() const
+{
+	return m_cacheStats;
+}
+
+PSF::CachedGlyph const& PSF::getCachedGlyph(unsigned char const* glyph, uint16_t idx, int scale)
+{
+	auto key = ((uint32_t)idx * max_cached_scale) + (uint32_t)(scale - 1);
+
+	auto slot = m_cacheIndex[key];
+	if (slot != cache_index_empty) {
+		m_cacheStats.hits++;
+		m_cache[slot].lastUse = ++m_cacheClock;
+		return m_cache[slot];
+	}
+	m_cacheStats.misses++;
+
+	// Expand full unclipped glyph
+	auto width = (int)psf1_charwidth * scale;
+	auto height = (int)m_header.charsize * scale;
+	auto pixels = std::vector<unsigned char>(width * height);
+	switch (scale) {
+	case 1:
+		blit_glyph<1>(glyph, pixels.data(), width, width, height, scale);
+		break;
+	case 2:
+		blit_glyph<2>(glyph, pixels.data(), width, width, height, scale);
+		break;
+	default:
+		blit_glyph<0>(glyph, pixels.data(), width, width, height, scale);
+		break;
+	}
+
+	// Fill free slot or evict least recently used
+	if (m_cache.size() < m_cacheCapacity) {
+		slot = m_cache.size();
+		m_cache.push_back(CachedGlyph{});
+	} else {
+		slot = 0;
+		for (size_t i = 1; i < m_cache.size(); i++) {
+			if (m_cache[i].lastUse < m_cache[slot].lastUse) {
+				slot = i;
+			}
+		}
+		m_cacheIndex[m_cache[slot].key] = cache_index_empty;
+		m_cacheStats.evictions++;
+	}
+
+	m_cache[slot] = CachedGlyph{std::move(pixels), ++m_cacheClock, key};
+	m_cacheIndex[key] = slot;
+
+	return m_cache[slot];
+}
+
+// Copy rows of pre-expanded glyph, constant size when unclipped
+template <int Width>
+static void copy_rows(unsigned char* dest, int pitch, unsigned char const* src,
+	int src_pitch, int dest_width, int dest_height)
+{
+	for (int dy = 0; dy < dest_height; dy++) {
+		copy_row<Width>(dest + (dy * pitch), src + (dy * src_pitch), dest_width);
+	}
+}
+
+unsigned char const* PSF::getGlyph(uint16_t idx)
+{
+	if (idx == Utf16Table::missing) {
+		return nullptr;
 	}
-	auto idx = utf16Psfindex->second;
 
 	// Check character
-	if ((idx < 0) || (idx > 0x1ff)) {
+	if (idx > 0x1ff) {
 		throw std::logic_error("character out of range");
 	}
 
@@ -99,39 +270,148 @@ void PSF::drawUtf16(uint16_t utf16,
 	if (sizeof(m_header) + (m_header.charsize * idx) >= m_psfSize) {
 		throw std::runtime_error("character index out of range");
 	}
-	auto glyph = m_psfData + sizeof(m_header) + (m_header.charsize * idx);
+	return m_psfData + sizeof(m_header) + (m_header.charsize * idx);
+}
 
-	// Starting coordinates
+// Resolve negative coordinates from far edge, false if nothing to draw
+static bool clip_origin(int& x, int& y, int buf_width, int buf_height, int scale)
+{
 	y = (y < 0) ? buf_height + y : y;
-	if (y >= buf_height) {
-		return;
+	if ((y < 0) || (y >= buf_height)) {
+		return false;
 	}
 	x = (x < 0) ? buf_width + x : x;
-	if (x >= buf_width) {
+	if ((x < 0) || (x >= buf_width)) {
+		return false;
+	}
+	return (scale > 0);
+}
+
+void PSF::drawUtf16(uint16_t utf16,
+	unsigned char *buf, int buf_width, int buf_height,
+	int x, int y, int scale)
+{
+	drawGlyph(m_table.find(utf16), buf, buf_width, buf_height, x, y, scale);
+}
+
+void PSF::drawGlyph(uint16_t idx,
+	unsigned char *buf, int buf_width, int buf_height,
+	int x, int y, int scale)
+{
+	auto glyph = getGlyph(idx);
+	if (glyph == nullptr) {
 		return;
 	}
 
-	// Draw character, black on white
-	for (int sy = 0; sy < m_header.charsize; sy++) {
+	// Starting coordinates
+	if (!clip_origin(x, y, buf_width, buf_height, scale)) {
+		return;
+	}
+
+	// Clip glyph rectangle once
+	auto dest_width = std::min((int)psf1_charwidth * scale, buf_width - x);
+	auto dest_height = std::min((int)m_header.charsize * scale, buf_height - y);
+	auto dest = buf + (y * buf_width) + x;
 
-		auto dy = y + (scale * sy);
-		if (dy >= buf_height) {
+	// Copy rows of pre-expanded glyph
+	if ((m_cacheCapacity > 0) && (scale <= max_cached_scale)) {
+		auto src = getCachedGlyph(glyph, idx, scale).pixels.data();
+		auto src_pitch = (int)psf1_charwidth * scale;
+		switch (scale) {
+		case 1:
+			copy_rows<psf1_charwidth>(dest, buf_width, src, src_pitch, dest_width, dest_height);
+			break;
+		case 2:
+			copy_rows<psf1_charwidth * 2>(dest, buf_width, src, src_pitch, dest_width, dest_height);
+			break;
+		default:
+			copy_rows<0>(dest, buf_width, src, src_pitch, dest_width, dest_height);
 			break;
 		}
+		return;
+	}
 
-		for (int sx = 0; sx < psf1_charwidth; sx++) {
+	// Draw character, black on white
+	switch (scale) {
+	case 1:
+		blit_glyph<1>(glyph, dest, buf_width, dest_width, dest_height, scale);
+		break;
+	case 2:
+		blit_glyph<2>(glyph, dest, buf_width, dest_width, dest_height, scale);
+		break;
+	default:
+		blit_glyph<0>(glyph, dest, buf_width, dest_width, dest_height, scale);
+		break;
+	}
+}
 
-			auto dx = x + (scale * sx);
-			if (dx >= buf_width) {
-				break;
+// Glyph row byte with each bit repeated twice
+static constexpr auto bits_x2 = []() {
+	auto result = std::array<uint16_t, 256>{};
+	for (int bits = 0; bits < 256; bits++) {
+		for (int sx = 0; sx < psf1_charwidth; sx++) {
+			if ((bits >> sx) & 1) {
+				result[bits] |= (3 << (2 * sx));
 			}
+		}
+	}
+	return result;
+}();
+
+void PSF::drawUtf16Mono(uint16_t utf16,
+	unsigned char *buf, int pitch, int buf_width, int buf_height,
+	int x, int y, int scale)
+{
+	drawGlyphMono(m_table.find(utf16), buf, pitch, buf_width, buf_height, x, y, scale);
+}
+
+void PSF::drawGlyphMono(uint16_t idx,
+	unsigned char *buf, int pitch, int buf_width, int buf_height,
+	int x, int y, int scale)
+{
+	auto glyph = getGlyph(idx);
+	if (glyph == nullptr) {
+		return;
+	}
+
+	// Starting coordinates
+	if (!clip_origin(x, y, buf_width, buf_height, scale)) {
+		return;
+	}
+
+	// Clip glyph rectangle once
+	auto shift = x % 8;
+	auto dest_width = std::min({(int)psf1_charwidth * scale, buf_width - x, 64 - shift});
+	auto dest_height = std::min((int)m_header.charsize * scale, buf_height - y);
+	auto num_bytes = (shift + dest_width + 7) / 8;
+	auto mask = ~uint64_t{0} << (64 - dest_width);
 
-			auto pixel = (glyph[sy] >> (7 - sx)) & 1;
-			for (int dsx = 0; dsx < scale; dsx++) {
-				for (int dsy = 0; dsy < scale; dsy++) {
-					buf[((dy + dsy) * buf_width) + dx + dsx] = (pixel ? 0x00 : 0xff);
+	for (int dy = 0; dy < dest_height; dy += scale) {
+		auto bits = glyph[dy / scale];
+
+		// Left-align scaled row in 64 bits, MSB leftmost
+		auto line = uint64_t{0};
+		if (scale == 1) {
+			line = (uint64_t)bits << 56;
+		} else if (scale == 2) {
+			line = (uint64_t)bits_x2[bits] << 48;
+		} else {
+			auto run = (scale < 64) ? (uint64_t{1} << scale) - 1 : ~uint64_t{0};
+			for (int sx = 0; (sx < psf1_charwidth) && ((sx + 1) * scale <= 64); sx++) {
+				if ((bits >> (7 - sx)) & 1) {
+					line |= run << (64 - ((sx + 1) * scale));
 				}
 			}
 		}
+		line = (line & mask) >> shift;
+
+		// OR clipped row into each destination row of the block, ink bits only
+		auto block_rows = std::min(scale, dest_height - dy);
+		for (int row = 0; row < block_rows; row++) {
+			auto dest = buf + ((y + dy + row) * pitch) + (x / 8);
+			for (int b = 0; b < num_bytes; b++) {
+				dest[b] |= (unsigned char)(line >> (56 - (8 * b)));
+			}
+		}
 	}
 }
@@ -1,12 +1,37 @@
 #pragma once
 
+#include <stdint.h>
+
+#include <array>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 class PSF
 {
 public: // types
-	using Utf16Table = std::unordered_map<uint16_t, uint16_t>;
+
+	// Two-level page table from BMP codepoint to glyph index.
+	// High byte selects a 256-entry page, page 0 is shared by all
+	// unmapped ranges so lookups never branch on presence.
+	class Utf16Table
+	{
+	public: // constants
+		static constexpr auto missing = uint16_t{0xffff};
+
+	private: // members
+		std::array<uint16_t, 256> m_directory;
+		std::vector<uint16_t> m_pages;
+
+	public: // interface
+		Utf16Table();
+
+		void set(uint16_t utf16, uint16_t glyph);
+
+		uint16_t find(uint16_t utf16) const
+		{
+			return m_pages[(m_directory[utf16 >> 8] << 8) | (utf16 & 0xff)];
+		}
+	};
 
 	struct psf1_header
 	{
@@ -15,21 +40,72 @@ public: // types
 		uint8_t  charsize;
 	}__attribute__((packed));
 
+	struct CacheStats
+	{
+		size_t hits, misses, evictions;
+	};
+
+private: // types
+
+	// Glyph pre-expanded to 8bpp at one scale
+	struct CachedGlyph
+	{
+		std::vector<unsigned char> pixels;
+		uint64_t lastUse;
+		uint32_t key;
+	};
+
 private: // members
 	unsigned char const* m_psfData;
 	size_t m_psfSize;
 	Utf16Table m_table;
 	psf1_header m_header;
 
+	// Direct-mapped index from (glyph index, scale) to cache slot,
+	// least recently used slot evicted when full
+	std::vector<uint16_t> m_cacheIndex;
+	std::vector<CachedGlyph> m_cache;
+	size_t m_cacheCapacity;
+	uint64_t m_cacheClock;
+	CacheStats m_cacheStats;
+
+private: // helpers
+	unsigned char const* getGlyph(uint16_t idx);
+	CachedGlyph const& getCachedGlyph(unsigned char const* glyph, uint16_t idx, int scale);
+
 public: // interface
 	PSF(unsigned char const* psf_data, size_t psf_size);
 
 	size_t getHeight();
 	size_t getWidth();
 
+	// Glyph index for codepoint, Utf16Table::missing if unmapped
+	uint16_t getGlyphIndex(uint16_t utf16) const;
+
+	// Keep up to max_glyphs expanded bitmaps for scales up to
+	// max_cached_scale, 0 disables caching. Used by drawUtf16 and
+	// drawGlyph only, Mono1 drawing expands rows directly
+	static constexpr auto max_cached_scale = 4;
+	void enableGlyphCache(size_t max_glyphs);
+	CacheStats getCacheStats() const;
+
 	void drawUtf16(uint16_t utf16,
 		unsigned char *buf, int buf_width, int buf_height,
 		int x, int y, int scale);
 
+	// Packed 1bpp target, sets ink bits and leaves background untouched.
+	// Rows are clipped to the 64-bit span starting at the byte holding x
+	void drawUtf16Mono(uint16_t utf16,
+		unsigned char *buf, int pitch, int buf_width, int buf_height,
+		int x, int y, int scale);
+
+	// Draw by glyph index already looked up, e.g. from a compiled keymap
+	void drawGlyph(uint16_t idx,
+		unsigned char *buf, int buf_width, int buf_height,
+		int x, int y, int scale);
+	void drawGlyphMono(uint16_t idx,
+		unsigned char *buf, int pitch, int buf_width, int buf_height,
+		int x, int y, int scale);
+
 };
 
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stddef.h>
+
+#include <vector>
+
+// Overlay bitmap layouts, matching SHARP_OVERLAY_FMT_* in ioctl_iface.h
+enum class PixelFormat
+{
+	Gray8, // One byte per pixel, 0x00 black, 0xff white
+	Mono1, // One bit per pixel, MSB first, set bit black, rows byte-padded
+};
+
+static inline size_t get_pitch(PixelFormat format, size_t width)
+{
+	return (format == PixelFormat::Mono1)
+		? (width + 7) / 8
+		: width;
+}
+
+// Expand packed bitmap for drivers that only accept 8bpp
+static inline auto unpack_mono(unsigned char const* pix, size_t width, size_t height)
+{
+	auto pitch = get_pitch(PixelFormat::Mono1, width);
+	auto result = std::vector<unsigned char>(width * height);
+	for (size_t y = 0; y < height; y++) {
+		for (size_t x = 0; x < width; x++) {
+			auto bit = (pix[(y * pitch) + (x / 8)] >> (7 - (x % 8))) & 1;
+			result[(y * width) + x] = (bit) ? 0x00 : 0xff;
+		}
+	}
+	return result;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <optional>
+
+#include "PixelFormat.hpp"
+
+// Overlay bitmaps rendered on the build host by prerender.cpp and
+// linked in with objcopy. Header is followed by pitch * height pixels
+namespace Prerendered
+{
+
+static constexpr char magic[4] = {'S', 'O', 'P', 'R'};
+static constexpr auto version = uint32_t{1};
+
+struct Header
+{
+	char     magic[4];
+	uint32_t version;
+	uint32_t width; // 0 if nothing was rendered
+	uint32_t height;
+	uint32_t format;
+	uint32_t reserved;
+	uint64_t keymapHash; // FNV-1a of source keymap text, 0 for Meta
+}__attribute__((packed));
+
+struct View
+{
+	size_t width, height;
+	PixelFormat format;
+	uint64_t keymapHash;
+	unsigned char const* pixels;
+};
+
+// Validate linked bitmap, nullopt if empty or from another version
+static inline std::optional<View> get_view(unsigned char const* data, size_t size)
+{
+	if (size < sizeof(Header)) {
+		return std::nullopt;
+	}
+	auto header = Header{};
+	::memcpy(&header, data, sizeof(header));
+
+	if ((::memcmp(header.magic, magic, sizeof(magic)) != 0)
+	 || (header.version != version)
+	 || (header.width == 0)
+	 || (header.format > (uint32_t)PixelFormat::Mono1)) {
+		return std::nullopt;
+	}
+	auto format = (PixelFormat)header.format;
+	if (size != sizeof(Header) + (get_pitch(format, header.width) * header.height)) {
+		return std::nullopt;
+	}
+
+	return View{header.width, header.height, format, header.keymapHash,
+		data + sizeof(Header)};
+}
+
+} // namespace Prerendered
@@ -0,0 +1,333 @@
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include <atomic>
+#include <vector>
+
+#include "Profile.hpp"
+
+namespace Profile
+{
+
+bool enabled = false;
+bool events_enabled = false;
+
+struct Phase
+{
+	char const* name;
+	size_t count;
+	uint64_t ns;
+	uint64_t events[max_events];
+};
+
+struct Counter
+{
+	char const* name;
+	uint64_t value;
+};
+
+struct Latency
+{
+	char const* name;
+	LatencyHistogram histogram;
+};
+
+struct EventType
+{
+	char const* name;
+	uint32_t type;
+	uint64_t config;
+};
+
+// Phases in order first seen
+static auto phases = std::vector<Phase>{};
+static auto counters = std::vector<Counter>{};
+static auto latencies = std::vector<Latency>{};
+
+// Constant-initialized, usable by allocations made during static init
+static auto allocation_count = std::atomic<size_t>{0};
+static auto allocation_bytes = std::atomic<size_t>{0};
+
+static uint64_t start_ns;
+
+// Group leader first. Page faults are a software event and can join a
+// hardware group
+static constexpr EventType hardware_events[] =
+	{ {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES}
+	, {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS}
+	, {"cache_references", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES}
+	, {"cache_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES}
+	, {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}
+	, {"page_faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS}
+};
+static constexpr EventType software_events[] =
+	{ {"task_clock_ns", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK}
+	, {"page_faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS}
+	, {"context_switches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES}
+	, {"cpu_migrations", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CPU_MIGRATIONS}
+};
+
+// Open group, leader's descriptor first. Members the CPU lacks are
+// left out
+static char const* event_mode = "none";
+static char const* event_names[max_events];
+static size_t num_events = 0;
+static int event_fds[max_events];
+
+// Runs before other static constructors
+__attribute__((constructor(101)))
+static void record_start()
+{
+	start_ns = now_ns();
+}
+
+static int open_event(EventType const& eventType, bool exclude_kernel, int group_fd)
+{
+	auto attr = perf_event_attr{};
+	attr.size = sizeof(attr);
+	attr.type = eventType.type;
+	attr.config = eventType.config;
+	attr.disabled = (group_fd < 0);
+	attr.exclude_kernel = exclude_kernel;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP
+		| PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+	// This process on any CPU
+	return ::syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, PERF_FLAG_FD_CLOEXEC);
+}
+
+static void close_events()
+{
+	for (size_t i = 0; i < num_events; i++) {
+		::close(event_fds[i]);
+	}
+	num_events = 0;
+}
+
+template <size_t N>
+static bool open_events(EventType const (&eventTypes)[N], bool exclude_kernel)
+{
+	for (auto const& eventType : eventTypes) {
+		auto group_fd = (num_events > 0) ? event_fds[0] : -1;
+		auto fd = open_event(eventType, exclude_kernel, group_fd);
+		if (fd < 0) {
+			if (num_events == 0) {
+				return false;
+			}
+			continue;
+		}
+		event_names[num_events] = eventType.name;
+		event_fds[num_events] = fd;
+		num_events++;
+	}
+
+	if (::ioctl(event_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) < 0) {
+		auto err = errno;
+		close_events();
+		errno = err;
+		return false;
+	}
+	return true;
+}
+
+uint64_t now_ns()
+{
+	auto ts = timespec{};
+	::clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * 1000000000) + ts.tv_nsec;
+}
+
+void enable(uint64_t main_ns)
+{
+	phases.reserve(32);
+	counters.reserve(16);
+	enabled = true;
+	add_phase("static_init", main_ns - start_ns);
+}
+
+bool enable_events()
+{
+	// Fall back as perf_event_paranoid and PMU support allow
+	if (open_events(hardware_events, false)) {
+		event_mode = "hardware";
+	} else if (open_events(hardware_events, true)) {
+		event_mode = "hardware_user";
+	} else if (open_events(software_events, false)) {
+		event_mode = "software";
+	} else if (open_events(software_events, true)) {
+		event_mode = "software_user";
+	} else {
+		return false;
+	}
+
+	events_enabled = true;
+	return true;
+}
+
+void read_events(uint64_t* counts)
+{
+	struct
+	{
+		uint64_t nr;
+		uint64_t timeEnabled;
+		uint64_t timeRunning;
+		uint64_t values[max_events];
+	} group{};
+
+	for (size_t i = 0; i < max_events; i++) {
+		counts[i] = 0;
+	}
+	if (::read(event_fds[0], &group, sizeof(group)) < (ssize_t)(3 * sizeof(uint64_t))) {
+		return;
+	}
+
+	// Estimate full counts if the PMU was shared with other events
+	for (size_t i = 0; (i < group.nr) && (i < max_events); i++) {
+		counts[i] = ((group.timeRunning > 0) && (group.timeRunning < group.timeEnabled))
+			? (uint64_t)((double)group.values[i] * group.timeEnabled / group.timeRunning)
+			: group.values[i];
+	}
+}
+
+void add_phase(char const* name, uint64_t ns, uint64_t const* event_deltas)
+{
+	auto it = phases.begin();
+	while ((it != phases.end()) && (::strcmp(it->name, name) != 0)) {
+		it++;
+	}
+	if (it == phases.end()) {
+		it = phases.insert(it, Phase{name, 0, 0, {}});
+	}
+
+	it->count++;
+	it->ns += ns;
+	if (event_deltas != nullptr) {
+		for (size_t i = 0; i < max_events; i++) {
+			it->events[i] += event_deltas[i];
+		}
+	}
+}
+
+void set_counter(char const* name, uint64_t value)
+{
+	for (auto& counter : counters) {
+		if (::strcmp(counter.name, name) == 0) {
+			counter.value = value;
+			return;
+		}
+	}
+	counters.push_back(Counter{name, value});
+}
+
+void add_latency(char const* name, LatencyHistogram const& histogram)
+{
+	if (histogram.getCount() == 0) {
+		return;
+	}
+	for (auto& latency : latencies) {
+		if (::strcmp(latency.name, name) == 0) {
+			latency.histogram.merge(histogram);
+			return;
+		}
+	}
+	latencies.push_back(Latency{name, histogram});
+}
+
+void count_allocation(size_t size)
+{
+	allocation_count.fetch_add(1, std::memory_order_relaxed);
+	allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void print(FILE* file, bool json)
+{
+	auto usage = rusage{};
+	::getrusage(RUSAGE_SELF, &usage);
+	auto const peak_rss_kb = (uint64_t)usage.ru_maxrss;
+	auto const count = allocation_count.load(std::memory_order_relaxed);
+	auto const bytes = allocation_bytes.load(std::memory_order_relaxed);
+
+	// Static init ran before counting started
+	auto const has_events = [](Phase const& phase) {
+		return events_enabled && (::strcmp(phase.name, "static_init") != 0);
+	};
+
+	if (json) {
+		fprintf(file, "{\"phases\":[");
+		for (size_t i = 0; i < phases.size(); i++) {
+			fprintf(file, "%s{\"name\":\"%s\",\"count\":%zu,\"ns\":%llu",
+				(i > 0) ? "," : "", phases[i].name, phases[i].count,
+				(unsigned long long)phases[i].ns);
+			if (has_events(phases[i])) {
+				for (size_t j = 0; j < num_events; j++) {
+					fprintf(file, ",\"%s\":%llu", event_names[j],
+						(unsigned long long)phases[i].events[j]);
+				}
+			}
+			fprintf(file, "}");
+		}
+		fprintf(file, "],\"allocations\":%zu,\"allocated_bytes\":%zu,\"peak_rss_kb\":%llu",
+			count, bytes, (unsigned long long)peak_rss_kb);
+		if (events_enabled) {
+			fprintf(file, ",\"events\":\"%s\"", event_mode);
+		}
+		fprintf(file, ",\"latencies\":[");
+		for (size_t i = 0; i < latencies.size(); i++) {
+			auto const& histogram = latencies[i].histogram;
+			fprintf(file, "%s{\"name\":\"%s\",\"count\":%llu,\"min_ns\":%llu,\"p50_ns\":%llu"
+				",\"p90_ns\":%llu,\"p99_ns\":%llu,\"max_ns\":%llu}",
+				(i > 0) ? "," : "", latencies[i].name,
+				(unsigned long long)histogram.getCount(),
+				(unsigned long long)histogram.getMinNs(),
+				(unsigned long long)histogram.getPercentile(0.50),
+				(unsigned long long)histogram.getPercentile(0.90),
+				(unsigned long long)histogram.getPercentile(0.99),
+				(unsigned long long)histogram.getMaxNs());
+		}
+		fprintf(file, "]");
+		for (auto const& counter : counters) {
+			fprintf(file, ",\"%s\":%llu", counter.name, (unsigned long long)counter.value);
+		}
+		fprintf(file, "}\n");
+		return;
+	}
+
+	for (auto const& phase : phases) {
+		fprintf(file, "%-20s %4zu x %10.3f ms\n", phase.name, phase.count, phase.ns / 1e6);
+		if (has_events(phase)) {
+			fprintf(file, "  ");
+			for (size_t j = 0; j < num_events; j++) {
+				fprintf(file, " %s %llu", event_names[j], (unsigned long long)phase.events[j]);
+			}
+			fprintf(file, "\n");
+		}
+	}
+	if (events_enabled) {
+		fprintf(file, "events: %s\n", event_mode);
+	}
+	if (!latencies.empty()) {
+		fprintf(file, "latencies:\n");
+	}
+	for (auto const& latency : latencies) {
+		auto const& histogram = latency.histogram;
+		fprintf(file, "  %-18s %4llu calls, min %.3f p50 %.3f p90 %.3f p99 %.3f max %.3f ms\n",
+			latency.name, (unsigned long long)histogram.getCount(),
+			histogram.getMinNs() / 1e6, histogram.getPercentile(0.50) / 1e6,
+			histogram.getPercentile(0.90) / 1e6, histogram.getPercentile(0.99) / 1e6,
+			histogram.getMaxNs() / 1e6);
+	}
+	fprintf(file, "allocations: %zu, %zu bytes\n", count, bytes);
+	fprintf(file, "peak rss: %llu kB\n", (unsigned long long)peak_rss_kb);
+	for (auto const& counter : counters) {
+		fprintf(file, "%s: %llu\n", counter.name, (unsigned long long)counter.value);
+	}
+}
+
+} // namespace Profile
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "LatencyHistogram.hpp"
+
+// Per-phase wall-clock durations, heap allocation counts and peak RSS of
+// one run, collected for --stats. Timers cost one branch until enabled
+namespace Profile
+{
+
+// Most CPU events counted per phase
+static constexpr auto max_events = size_t{6};
+
+extern bool enabled;
+extern bool events_enabled;
+
+uint64_t now_ns();
+
+// Start collecting. main_ns is when main was entered, the time since
+// the earliest static constructor is reported as static init
+void enable(uint64_t main_ns);
+
+// Also count CPU events per phase with a perf_event_open group: cycles,
+// instructions, cache references and misses, branch misses and page
+// faults. Kernel time is left out if not permitted, and software events
+// (task clock, page faults, context switches, migrations) are counted
+// if the hardware PMU is not available. Returns false with errno set if
+// no events can be counted
+bool enable_events();
+
+// Current count of each enabled event, scaled for multiplexing
+void read_events(uint64_t* counts);
+
+// Add duration and event count deltas, if any, to named phase.
+// Repeated phases accumulate
+void add_phase(char const* name, uint64_t ns, uint64_t const* event_deltas = nullptr);
+
+// Report a named value alongside the phases
+void set_counter(char const* name, uint64_t value);
+
+// Add to named latency distribution, reported with percentiles
+void add_latency(char const* name, LatencyHistogram const& histogram);
+
+// Counted by the operator new linked into symbol-overlay, zero otherwise
+void count_allocation(size_t size);
+
+// Phases, allocations, peak RSS and counters as text, or JSON on one line
+void print(FILE* file, bool json);
+
+// Time enclosing scope as phase
+class Timer
+{
+private: // members
+	char const* m_name;
+	uint64_t m_startEvents[max_events];
+	uint64_t m_startNs;
+
+public: // interface
+	Timer(char const* name)
+		: m_name{name}
+		, m_startEvents{}
+		, m_startNs{0}
+	{
+		if (enabled) {
+			if (events_enabled) {
+				read_events(m_startEvents);
+			}
+			m_startNs = now_ns();
+		}
+	}
+
+	~Timer()
+	{
+		stop();
+	}
+
+	// End phase before scope does
+	void stop()
+	{
+		if (!enabled || (m_startNs == 0)) {
+			return;
+		}
+
+		auto const ns = now_ns() - m_startNs;
+		m_startNs = 0;
+		if (!events_enabled) {
+			add_phase(m_name, ns);
+			return;
+		}
+
+		uint64_t deltas[max_events];
+		read_events(deltas);
+		for (size_t i = 0; i < max_events; i++) {
+			deltas[i] -= m_startEvents[i];
+		}
+		add_phase(m_name, ns, deltas);
+	}
+
+	Timer(Timer const&) = delete;
+	Timer& operator=(Timer const&) = delete;
+};
+
+} // namespace Profile
@@ -0,0 +1,259 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+
+#include "RenderCache.hpp"
+#include "fnv1a.hpp"
+
+using namespace std::literals;
+
+static constexpr char cache_magic[4] = {'S', 'O', 'R', 'C'};
+static constexpr auto cache_version = uint32_t{2};
+static constexpr auto cache_suffix = ".rle"sv;
+
+// Row encodings
+static constexpr auto row_repeat = uint8_t{0}; // Same as previous row
+static constexpr auto row_runs = uint8_t{1}; // (count, byte) pairs covering pitch
+
+static void append_row(std::vector<unsigned char>& out, unsigned char const* row, size_t pitch)
+{
+	out.push_back(row_runs);
+	for (size_t x = 0; x < pitch; ) {
+		auto run = size_t{1};
+		while ((x + run < pitch) && (run < 0xff) && (row[x + run] == row[x])) {
+			run++;
+		}
+		out.push_back(run);
+		out.push_back(row[x]);
+		x += run;
+	}
+}
+
+static auto encode_rows(unsigned char const* pix, size_t pitch, size_t height)
+{
+	auto result = std::vector<unsigned char>{};
+	for (size_t y = 0; y < height; y++) {
+		auto row = &pix[y * pitch];
+		if ((y > 0) && (::memcmp(row, row - pitch, pitch) == 0)) {
+			result.push_back(row_repeat);
+		} else {
+			append_row(result, row, pitch);
+		}
+	}
+	return result;
+}
+
+// Returns false if encoding does not cover the bitmap exactly
+static bool decode_rows(unsigned char const* data, size_t size,
+	unsigned char* pix, size_t pitch, size_t height)
+{
+	auto end = data + size;
+	for (size_t y = 0; y < height; y++) {
+		if (data == end) {
+			return false;
+		}
+		auto row = &pix[y * pitch];
+
+		if (*data == row_repeat) {
+			if (y == 0) {
+				return false;
+			}
+			::memcpy(row, row - pitch, pitch);
+			data++;
+			continue;
+
+		} else if (*data != row_runs) {
+			return false;
+		}
+		data++;
+
+		for (size_t x = 0; x < pitch; ) {
+			if ((end - data) < 2) {
+				return false;
+			}
+			auto run = size_t{data[0]};
+			if ((run == 0) || (x + run > pitch)) {
+				return false;
+			}
+			::memset(&row[x], data[1], run);
+			x += run;
+			data += 2;
+		}
+	}
+
+	return (data == end);
+}
+
+// Negative y is relative to the bottom of the panel
+static bool fits_panel(RenderCache::Header const& header)
+{
+	auto const panel_width = (int64_t)RenderCache::panel_width;
+	auto const panel_height = (int64_t)RenderCache::panel_height;
+	auto first = (header.y < 0)
+		? panel_height + header.y
+		: (int64_t)header.y;
+	return (header.x >= 0) && ((header.x + (int64_t)header.width) <= panel_width)
+		&& (first >= 0) && ((first + (int64_t)header.height) <= panel_height);
+}
+
+RenderCache::RenderCache(char const* dir_path, size_t max_entries)
+	: m_dirPath{dir_path}
+	, m_maxEntries{max_entries}
+	, m_stats{}
+{
+	if ((::mkdir(dir_path, 0755) < 0) && (errno != EEXIST)) {
+		throw std::runtime_error("failed to create "s + dir_path + ": "
+			+ ::strerror(errno));
+	}
+}
+
+std::string RenderCache::getEntryPath(uint64_t key) const
+{
+	char name[17];
+	::snprintf(name, sizeof(name), "%016llx", (unsigned long long)key);
+	return m_dirPath + "/" + name + std::string{cache_suffix};
+}
+
+std::optional<RenderCache::Bitmap> RenderCache::load(uint64_t key)
+{
+	auto path = getEntryPath(key);
+
+	auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		m_stats.misses++;
+		return std::nullopt;
+	}
+
+	struct stat st{};
+	void* data = MAP_FAILED;
+	if ((::fstat(fd, &st) == 0) && ((size_t)st.st_size >= sizeof(Header))) {
+		data = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	::close(fd);
+	if (data == MAP_FAILED) {
+		m_stats.misses++;
+		return std::nullopt;
+	}
+
+	// Validate header and encoded rows. Dimensions are checked before the
+	// bitmap is allocated
+	auto const& header = *(Header const*)data;
+	auto encoded = (unsigned char const*)data + sizeof(Header);
+	auto valid = (::memcmp(header.magic, cache_magic, sizeof(cache_magic)) == 0)
+		&& (header.version == cache_version)
+		&& (header.key == key)
+		&& (header.format <= (uint32_t)PixelFormat::Mono1)
+		&& fits_panel(header)
+		&& ((size_t)st.st_size == sizeof(Header) + header.encodedSize)
+		&& (header.encodedHash == fnv1a64(encoded, header.encodedSize));
+
+	auto result = std::optional<Bitmap>{};
+	if (valid) {
+		auto format = (PixelFormat)header.format;
+		auto pitch = get_pitch(format, header.width);
+		auto pixels = std::vector<unsigned char>(pitch * header.height);
+		if (decode_rows(encoded, header.encodedSize, pixels.data(), pitch, header.height)) {
+			result = Bitmap{header.x, header.y, header.width, header.height, format,
+				std::move(pixels)};
+		}
+	}
+	::munmap(data, st.st_size);
+
+	if (!result) {
+		m_stats.misses++;
+		return std::nullopt;
+	}
+
+	// Mark as recently used for eviction
+	::utimensat(AT_FDCWD, path.c_str(), nullptr, 0);
+
+	m_stats.hits++;
+	return result;
+}
+
+void RenderCache::store(uint64_t key, int x, int y, size_t width, size_t height,
+	PixelFormat format, unsigned char const* pix)
+{
+	auto encoded = encode_rows(pix, get_pitch(format, width), height);
+
+	auto header = Header{};
+	::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+	header.version = cache_version;
+	header.key = key;
+	header.x = x;
+	header.y = y;
+	header.width = width;
+	header.height = height;
+	header.format = (uint32_t)format;
+	header.encodedSize = encoded.size();
+	header.encodedHash = fnv1a64(encoded.data(), encoded.size());
+
+	// Write atomically through a temporary file
+	auto path = getEntryPath(key);
+	auto tmp_path = path + ".tmp";
+	auto file = ::fopen(tmp_path.c_str(), "wb");
+	if (file == nullptr) {
+		throw std::runtime_error("failed to create "s + tmp_path + ": "
+			+ ::strerror(errno));
+	}
+
+	auto ok = (::fwrite(&header, sizeof(header), 1, file) == 1)
+		&& (::fwrite(encoded.data(), 1, encoded.size(), file) == encoded.size());
+	ok = (::fclose(file) == 0) && ok;
+	if (!ok || (::rename(tmp_path.c_str(), path.c_str()) < 0)) {
+		auto err = errno;
+		::unlink(tmp_path.c_str());
+		throw std::runtime_error("failed to write "s + path + ": "
+			+ ::strerror(err));
+	}
+
+	evict();
+}
+
+void RenderCache::evict()
+{
+	auto dir = ::opendir(m_dirPath.c_str());
+	if (dir == nullptr) {
+		return;
+	}
+
+	// Collect entries with last use time
+	auto entries = std::vector<std::pair<struct timespec, std::string>>{};
+	while (auto ent = ::readdir(dir)) {
+		auto name = std::string_view{ent->d_name};
+		if ((name.size() <= cache_suffix.size())
+		 || (name.substr(name.size() - cache_suffix.size()) != cache_suffix)) {
+			continue;
+		}
+		struct stat st{};
+		if (::fstatat(::dirfd(dir), ent->d_name, &st, 0) == 0) {
+			entries.emplace_back(st.st_mtim, std::string{name});
+		}
+	}
+	::closedir(dir);
+
+	if (entries.size() <= m_maxEntries) {
+		return;
+	}
+
+	// Remove oldest beyond limit
+	std::sort(entries.begin(), entries.end(), [](auto const& a, auto const& b) {
+		return std::make_pair(a.first.tv_sec, a.first.tv_nsec)
+			> std::make_pair(b.first.tv_sec, b.first.tv_nsec);
+	});
+	for (size_t i = m_maxEntries; i < entries.size(); i++) {
+		auto path = m_dirPath + "/" + entries[i].second;
+		if (::unlink(path.c_str()) == 0) {
+			m_stats.evictions++;
+		}
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <optional>
+
+#include "PixelFormat.hpp"
+
+// Directory of rendered overlay bitmaps, row-level RLE encoded and
+// named by a hash of everything the render depends on
+class RenderCache
+{
+public: // constants
+	// Sharp panel size, cached overlays must lie within it
+	static constexpr auto panel_width = size_t{400};
+	static constexpr auto panel_height = size_t{240};
+
+public: // types
+	struct Header
+	{
+		char     magic[4];
+		uint32_t version;
+		uint64_t key;
+		int32_t  x;
+		int32_t  y;
+		uint32_t width;
+		uint32_t height;
+		uint32_t format;
+		uint32_t encodedSize;
+		uint64_t encodedHash;
+	}__attribute__((packed));
+
+	struct Bitmap
+	{
+		int x, y; // Overlay position
+		size_t width, height;
+		PixelFormat format;
+		std::vector<unsigned char> pixels;
+	};
+
+	struct Stats
+	{
+		size_t hits, misses, evictions;
+	};
+
+private: // members
+	std::string m_dirPath;
+	size_t m_maxEntries;
+	Stats m_stats;
+
+private: // helpers
+	std::string getEntryPath(uint64_t key) const;
+	void evict();
+
+public: // interface
+	// Creates cache directory if missing, throws if unusable
+	RenderCache(char const* dir_path, size_t max_entries);
+
+	// Decode cached bitmap for key, nullopt if absent or invalid
+	std::optional<Bitmap> load(uint64_t key);
+
+	// Encode and store bitmap under key, evicting least recently used
+	// entries beyond the limit
+	void store(uint64_t key, int x, int y, size_t width, size_t height, PixelFormat format,
+		unsigned char const* pix);
+
+	Stats const& getStats() const { return m_stats; }
+};
@@ -0,0 +1,27 @@
+#include <stdlib.h>
+
+#include <new>
+
+#include "Profile.hpp"
+
+// Global allocation functions counting every heap allocation for
+// --stats. Array and nothrow forms forward to these
+
+void* operator new(size_t size)
+{
+	Profile::count_allocation(size);
+	if (auto ptr = ::malloc((size > 0) ? size : 1)) {
+		return ptr;
+	}
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+	::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	::free(ptr);
+}
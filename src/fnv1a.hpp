@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 64-bit FNV-1a, chainable by passing the previous result as hash
+static constexpr auto fnv1a64_basis = uint64_t{0xcbf29ce484222325};
+
+static inline uint64_t fnv1a64(void const* data, size_t size,
+	uint64_t hash = fnv1a64_basis)
+{
+	auto bytes = (unsigned char const*)data;
+	for (size_t i = 0; i < size; i++) {
+		hash = (hash ^ bytes[i]) * uint64_t{0x100000001b3};
+	}
+	return hash;
+}
@@ -23,6 +23,12 @@ static constexpr auto make_Param(char const* long_flag, int short_flag)
 	return GNUOption{long_flag, required_argument, nullptr, short_flag};
 }
 
+// Long form takes argument only as --flag=value
+static constexpr auto make_OptionalParam(char const* long_flag, int short_flag)
+{
+	return GNUOption{long_flag, optional_argument, nullptr, short_flag};
+}
+
 class IncomingArgv
 {
 private: // members
@@ -51,6 +57,9 @@ public: // interface
 				if (opt->has_arg != no_argument) {
 					m_flags.push_back(':');
 				}
+				if (opt->has_arg == optional_argument) {
+					m_flags.push_back(':');
+				}
 			}
 		}
 	}
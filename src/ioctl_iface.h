@@ -16,6 +16,27 @@ union sharp_memory_ioctl_ov_add_t
 	void *out_storage;
 };
 
+// One byte per pixel, 0x00 black, otherwise white (format of OV_ADD)
+#define SHARP_OVERLAY_FMT_GRAY8 0
+// One bit per pixel, MSB is leftmost, set bit black, rows are pitch bytes
+#define SHARP_OVERLAY_FMT_MONO1 1
+
+struct sharp_overlay_fmt_t
+{
+	int x, y, width, height;
+	unsigned int format;
+	unsigned int pitch;
+	unsigned char const *pixels;
+};
+
+// Drivers without OV_ADD_FMT reject it with EINVAL or ENOTTY,
+// userspace then converts to 8bpp and falls back to OV_ADD
+union sharp_memory_ioctl_ov_add_fmt_t
+{
+	struct sharp_overlay_fmt_t *in_overlay;
+	void *out_storage;
+};
+
 struct sharp_memory_ioctl_ov_rem_t
 {
 	void *storage;
@@ -32,6 +53,15 @@ struct sharp_memory_ioctl_ov_hide_t
 	void *display;
 };
 
+// While set, overlay ioctls on this file change overlay state without
+// refreshing the panel. The next REDRAW refreshes once and clears it.
+// Drivers without OV_DEFER reject it with EINVAL or ENOTTY, userspace
+// then lets each ioctl refresh and skips the REDRAW
+struct sharp_memory_ioctl_ov_defer_t
+{
+	int defer;
+};
+
 int sharp_memory_ioctl_redraw(struct drm_device *dev, void *,
 	struct drm_file *file);
 
@@ -45,6 +75,10 @@ int sharp_memory_ioctl_ov_hide(struct drm_device *dev, void *display,
 	struct drm_file *file);
 int sharp_memory_ioctl_ov_clear(struct drm_device *dev, void *,
 	struct drm_file *file);
+int sharp_memory_ioctl_ov_add_fmt(struct drm_device *dev, \
+	void *in_overlay_out_storage, struct drm_file *file);
+int sharp_memory_ioctl_ov_defer(struct drm_device *dev, void *defer,
+	struct drm_file *file);
 
 // No parameters, callable from kernel space
 #define DRM_SHARP_REDRAW 0x00
@@ -55,6 +89,8 @@ int sharp_memory_ioctl_ov_clear(struct drm_device *dev, void *,
 #define DRM_SHARP_OV_SHOW 0x12
 #define DRM_SHARP_OV_HIDE 0x13
 #define DRM_SHARP_OV_CLEAR 0x14
+#define DRM_SHARP_OV_ADD_FMT 0x15
+#define DRM_SHARP_OV_DEFER 0x16
 
 #define DRM_IOCTL_SHARP_REDRAW \
 	DRM_IO(DRM_COMMAND_BASE + DRM_SHARP_REDRAW)
@@ -73,6 +109,12 @@ int sharp_memory_ioctl_ov_clear(struct drm_device *dev, void *,
 		struct sharp_memory_ioctl_ov_hide_t)
 #define DRM_IOCTL_SHARP_OV_CLEAR \
 	DRM_IO(DRM_COMMAND_BASE + DRM_SHARP_OV_CLEAR)
+#define DRM_IOCTL_SHARP_OV_ADD_FMT \
+	DRM_IOWR(DRM_COMMAND_BASE + DRM_SHARP_OV_ADD_FMT, \
+		union sharp_memory_ioctl_ov_add_fmt_t)
+#define DRM_IOCTL_SHARP_OV_DEFER \
+	DRM_IOW(DRM_COMMAND_BASE + DRM_SHARP_OV_DEFER, \
+		struct sharp_memory_ioctl_ov_defer_t)
 
 #define DRM_IOCTL_DEF_DRV_REDRAW \
 	DRM_IOCTL_DEF_DRV(SHARP_REDRAW, sharp_memory_ioctl_redraw, DRM_RENDER_ALLOW)
@@ -87,5 +129,9 @@ int sharp_memory_ioctl_ov_clear(struct drm_device *dev, void *,
 	DRM_IOCTL_DEF_DRV(SHARP_OV_HIDE, sharp_memory_ioctl_ov_hide, DRM_RENDER_ALLOW)
 #define DRM_IOCTL_DEF_DRV_OV_CLEAR \
 	DRM_IOCTL_DEF_DRV(SHARP_OV_CLEAR, sharp_memory_ioctl_ov_clear, DRM_RENDER_ALLOW)
+#define DRM_IOCTL_DEF_DRV_OV_ADD_FMT \
+	DRM_IOCTL_DEF_DRV(SHARP_OV_ADD_FMT, sharp_memory_ioctl_ov_add_fmt, DRM_RENDER_ALLOW)
+#define DRM_IOCTL_DEF_DRV_OV_DEFER \
+	DRM_IOCTL_DEF_DRV(SHARP_OV_DEFER, sharp_memory_ioctl_ov_defer, DRM_RENDER_ALLOW)
 
 #endif
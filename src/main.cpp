@@ -1,23 +1,39 @@
 #include <stdio.h>
 #include <string.h>
+#include <errno.h>
 
 #include <unistd.h>
+#include <sys/stat.h>
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <array>
+#include <algorithm>
 #include <map>
+#include <optional>
+#include <utility>
 #include <stdexcept>
-#include <fstream>
 #include <tuple>
+#include <charconv>
 
 #include "Overlay.hpp"
 #include "KeymapRender.hpp"
+#include "KeymapFile.hpp"
+#include "Keymaps.hpp"
+#include "CompiledKeymap.hpp"
+#include "RenderCache.hpp"
+#include "Prerendered.hpp"
+#include "OverlayState.hpp"
+#include "MockBackend.hpp"
+#include "LcdSimBackend.hpp"
+#include "fnv1a.hpp"
+#include "Control.hpp"
+#include "Daemon.hpp"
+#include "Profile.hpp"
 
 #include "getopt.hpp"
 
-// src/x11name_to_utf16.cpp
-extern uint16_t x11name_to_utf16(std::string const& x11name);
-
 // Converted font
 extern "C" {
 extern const char _binary_font_psf_start;
@@ -28,6 +44,14 @@ static const auto psf_size = (size_t)(
 	(unsigned char const*)&_binary_font_psf_end
 		- (unsigned char const*)&_binary_font_psf_start);
 
+// Overlays rendered at build time
+extern "C" {
+extern const char _binary_meta_overlay_bin_start;
+extern const char _binary_meta_overlay_bin_end;
+extern const char _binary_symbol_overlay_bin_start;
+extern const char _binary_symbol_overlay_bin_end;
+}
+
 using namespace std::literals;
 
 #ifndef DEFAULT_KEYMAP_PATH
@@ -35,103 +59,200 @@ using namespace std::literals;
 #endif
 static auto const default_keymap_path = DEFAULT_KEYMAP_PATH;
 
-static constexpr auto left_arrow = uint16_t{0x2190};
-static constexpr auto right_arrow = uint16_t{0x2192};
-static constexpr auto up_arrow = uint16_t{0x2191};
-static constexpr auto down_arrow = uint16_t{0x2193};
-
-static const auto symkeyMetaMap = KeymapRender::ThreeKeymap
-	{ {16, {'W', 'd', left_arrow}}, {17, {left_arrow, '\0', '\0'}}, {18, {up_arrow, '\0', '\0'}}, {19, {'H', 'o', 'm'}}, {20, {'T', 'a', 'b'}}, {21, {}}
-	  , {22, {}}, {23, {}}, {24, {'P', 'g', up_arrow}}, {25, {'P', 'g', down_arrow}}
-	, {30, {'W', 'd', right_arrow}}, {31, {down_arrow, '\0', '\0'}}, {32, {right_arrow, '\0', '\0'}}, {33, {'E', 'n', 'd'}}, {34, {}}, {35, {}}
-	  , {36, {}}, {37, {}}, {38, {}}
-	, { 0, {}}, {44, {}}, {45, {'C', 't', 'l'}}, {46, {'A', 'l', 't'}}, {47, {}}, {48, {}}
-	  , {49, {'K', 'b', down_arrow}}, {50, {'K', 'b', up_arrow}}, {113, {'K', 'b', 't'}}
-};
-
-// Convert X keymap into map from keycode to x11name
-static auto parse_keymap(char const* keymap_path)
-{
-	auto result = std::map<int, std::string>{};
-
-	auto keymap = std::ifstream{keymap_path};
+#ifndef DEFAULT_COMPILED_KEYMAP_PATH
+#define DEFAULT_COMPILED_KEYMAP_PATH "/var/cache/symbol-overlay/beepy-kbd.kmc"
+#endif
+static auto const default_compiled_keymap_path = DEFAULT_COMPILED_KEYMAP_PATH;
 
-	//altgr keycode 50 = guillemotright
-	auto line = std::string{};
-	while (std::getline(keymap, line)) {
+#ifndef DEFAULT_CACHE_DIR
+#define DEFAULT_CACHE_DIR "/var/cache/symbol-overlay"
+#endif
+static auto const default_cache_dir = DEFAULT_CACHE_DIR;
 
-		// Ignore empty or comment lines
-		if (line.empty() || (line[0] == '#')) {
-			continue;
-		}
+#ifndef DEFAULT_STATE_PATH
+#define DEFAULT_STATE_PATH "/run/symbol-overlay.state"
+#endif
+static auto const default_state_path = DEFAULT_STATE_PATH;
 
-		// Find altgr modifier lines
-		if (line.find("altgr ") != 0) {
-			continue;
-		}
+#ifndef DEFAULT_SOCKET_PATH
+#define DEFAULT_SOCKET_PATH "/run/symbol-overlay.sock"
+#endif
+static auto const default_socket_path = DEFAULT_SOCKET_PATH;
 
-		// Get keycode
-		auto keycode_delim = std::string{"keycode "};
-		auto keycode_at = line.find(keycode_delim);
-		if (keycode_at == std::string::npos) {
-			continue;
-		}
-		auto keycode = int{};
-		try {
-			keycode = std::stoi(line.substr(keycode_at + keycode_delim.size()));
-		} catch (std::exception const& ex) {
-			throw std::runtime_error("failed to parse line: "s + line);
-		}
+#ifndef DEFAULT_TRACE_MARKER_PATH
+#define DEFAULT_TRACE_MARKER_PATH "/sys/kernel/tracing/trace_marker"
+#endif
+static auto const default_trace_marker_path = DEFAULT_TRACE_MARKER_PATH;
 
-		// Get mapping name
-		auto equals_delim = std::string{"="};
-		auto equals_at = line.find(equals_delim);
-		if (equals_at == std::string::npos) {
-			continue;
-		}
-		auto mapping = line.substr(equals_at + equals_delim.size());
+// Keys held to show each layer with --input. Sym sends right Alt,
+// which the Symbol keymap binds as AltGr
+#ifndef SYMBOL_KEYCODE
+#define SYMBOL_KEYCODE 100 // KEY_RIGHTALT
+#endif
+#ifndef META_KEYCODE
+#define META_KEYCODE 125 // KEY_LEFTMETA
+#endif
 
-		// Trim comments and whitespace
-		auto hash_at = mapping.find("#");
-		if (hash_at != std::string::npos) {
-			mapping = mapping.substr(0, hash_at);
-		}
-		mapping.erase(0, mapping.find_first_not_of(" "));
-		mapping.erase(mapping.find_last_not_of(" ") + 1);
+static constexpr auto ioctl_backend = "ioctl"sv;
+static constexpr auto mock_backend_prefix = "mock:"sv;
+static constexpr auto sim_backend = "sim"sv;
 
-		result[keycode] = std::move(mapping);
-	}
 
-	return result;
-}
+// Room for a few keymap revisions of both layers
+static constexpr auto render_cache_size = size_t{8};
 
 static void usage(char const* const* argv)
 {
-	fprintf(stderr, "usage: %s sharp_dev [--clear-all] [--meta] [--keymap=<path>] sharp_dev \n", argv[0]);
+	fprintf(stderr, "usage: %s [--clear-all] [--hide] [--meta] [--compact] [--keymap=<path>] [--compiled-keymap=<path>] [--cache-dir=<path>] [--state=<path>] [--stats[=json]] [--perf] [--trace-marker[=<path>]] [--daemon] [--socket=<path>] [--input=<path>] [--hold-ms=<ms>] [--watch] [--backend=<backend>] sharp_dev\n", argv[0]);
+	fprintf(stderr, "       %s --send=<command> [--meta] [--key=<keycode>] [--socket=<path>]\n", argv[0]);
+	fprintf(stderr, "       %s [--keymap=<path>] [--compiled-keymap=<path>] compile-keymap\n", argv[0]);
 	fprintf(stderr, "sharp_dev    Sharp device to command (e.g. /dev/dri/card0)\n");
 	fprintf(stderr, "--clear-all  Clear all overlays and exit\n");
+	fprintf(stderr, "--hide       Hide overlay shown by an earlier run and exit\n");
 	fprintf(stderr, "--meta       Display Meta mode keymap instead of Symbol keymap\n");
+	fprintf(stderr, "--compact    Smaller overlay cropped to mapped keys, fewer lines to refresh\n");
 	fprintf(stderr, "--keymap     Path to X11 keymap to show for Symbol\n");
 	fprintf(stderr, "  (default %s)\n", default_keymap_path);
+	fprintf(stderr, "--compiled-keymap  Binary keymap used in place of --keymap when up to date\n");
+	fprintf(stderr, "  (default %s)\n", default_compiled_keymap_path);
+	fprintf(stderr, "compile-keymap  Write --keymap to --compiled-keymap and exit\n");
+	fprintf(stderr, "--cache-dir  Directory of rendered overlays, empty to disable\n");
+	fprintf(stderr, "  (default %s)\n", default_cache_dir);
+	fprintf(stderr, "--state      File recording overlays left on screen, empty to disable\n");
+	fprintf(stderr, "  (default %s)\n", default_state_path);
+	fprintf(stderr, "--stats      Print phase timings, allocations, peak RSS, render cache counters\n");
+	fprintf(stderr, "  and input latencies. --stats=json prints one JSON object to stdout\n");
+	fprintf(stderr, "--perf       --stats plus CPU cycles, instructions, cache and branch\n");
+	fprintf(stderr, "  misses and page faults per phase (software events if no PMU access)\n");
+	fprintf(stderr, "--trace-marker  Write ftrace markers before and after each driver call\n");
+	fprintf(stderr, "  (default %s)\n", default_trace_marker_path);
+	fprintf(stderr, "--daemon     Keep all overlays loaded and serve commands on socket\n");
+	fprintf(stderr, "--socket     Path to daemon control socket\n");
+	fprintf(stderr, "  (default %s)\n", default_socket_path);
+	fprintf(stderr, "--input      Daemon shows layers while Sym (%d) or Meta (%d) is held on evdev\n",
+		SYMBOL_KEYCODE, META_KEYCODE);
+	fprintf(stderr, "  device, or events \"<delay_ms> <keycode> <value>\" from pipe or file\n");
+	fprintf(stderr, "--hold-ms    Show only after key is held this long (default 0)\n");
+	fprintf(stderr, "--watch      Daemon re-renders Symbol layer when keymap changes\n");
+	fprintf(stderr, "--backend    Driver to send overlays to (default ioctl)\n");
+	fprintf(stderr, "  mock:<path>  In-memory driver, writes screen to <path> and calls to <path>.log,\n");
+	fprintf(stderr, "  sim[:<spi_hz>[:<vcom_hz>]]  In-memory driver reporting panel transfer cost\n");
+	fprintf(stderr, "               (default %u Hz SPI, %u Hz VCOM)\n",
+		LcdSimBackend::default_spi_hz, LcdSimBackend::default_vcom_hz);
+	fprintf(stderr, "  sharp_dev is not needed with in-memory drivers\n");
+	fprintf(stderr, "--send       Send command to running daemon and exit\n");
+	fprintf(stderr, "  (show, hide, clear, reload, highlight, unhighlight; layer selected by --meta;\n");
+	fprintf(stderr, "  stats prints latency percentiles, reset-stats clears them)\n");
+	fprintf(stderr, "--key        Keycode whose cell highlight inverts\n");
 }
 
-static auto parse_argv(int argc, char** argv)
+struct Options
+{
+	bool clear_all;
+	bool hide;
+	bool meta;
+	bool compact;
+	bool daemon;
+	bool compileKeymap;
+	bool stats;
+	bool statsJson;
+	bool perfEvents;
+	std::string traceMarkerPath;
+	std::string keymapPath;
+	std::string compiledKeymapPath;
+	std::string cacheDir;
+	std::string statePath;
+	std::string socketPath;
+	std::string sendCommand;
+	int keycode;
+	std::string backend;
+	std::string inputPath;
+	unsigned holdMs;
+	bool watch;
+	std::string sharpDev;
+};
+
+// Parse sim[:<spi_hz>[:<vcom_hz>]], false if not a simulator spec
+static bool parse_sim_backend(std::string_view spec, uint32_t& spi_hz, uint32_t& vcom_hz)
 {
-	auto clear_all = false;
-	auto meta = false;
-	auto keymapPath = std::string{default_keymap_path};
-	auto sharpDev = std::string{};
+	if (spec.substr(0, sim_backend.size()) != sim_backend) {
+		return false;
+	}
+	spec.remove_prefix(sim_backend.size());
+
+	spi_hz = LcdSimBackend::default_spi_hz;
+	vcom_hz = LcdSimBackend::default_vcom_hz;
+	for (auto value : {&spi_hz, &vcom_hz}) {
+		if (spec.empty()) {
+			return true;
+		}
+		if (spec[0] != ':') {
+			return false;
+		}
+		spec.remove_prefix(1);
 
+		auto [end, ec] = std::from_chars(spec.data(), spec.data() + spec.size(), *value);
+		if ((ec != std::errc{}) || (*value == 0)) {
+			return false;
+		}
+		spec.remove_prefix(end - spec.data());
+	}
+
+	return spec.empty();
+}
+
+static auto parse_argv(int argc, char** argv)
+{
+	auto options = Options
+		{ .clear_all = false
+		, .hide = false
+		, .meta = false
+		, .compact = false
+		, .daemon = false
+		, .compileKeymap = false
+		, .stats = false
+		, .statsJson = false
+		, .perfEvents = false
+		, .traceMarkerPath = std::string{}
+		, .keymapPath = std::string{default_keymap_path}
+		, .compiledKeymapPath = std::string{default_compiled_keymap_path}
+		, .cacheDir = std::string{default_cache_dir}
+		, .statePath = std::string{default_state_path}
+		, .socketPath = std::string{default_socket_path}
+		, .sendCommand = std::string{}
+		, .keycode = 0
+		, .backend = std::string{ioctl_backend}
+		, .inputPath = std::string{}
+		, .holdMs = 0
+		, .watch = false
+		, .sharpDev = std::string{}
+	};
 
 	constexpr auto ClearAll = Argv::make_Option("clear-all", 'c');
 	constexpr auto Help = Argv::make_Option("help", 'h');
+	constexpr auto Hide = Argv::make_Option("hide", 'H');
 	constexpr auto Meta = Argv::make_Option("meta", 'm');
+	constexpr auto Compact = Argv::make_Option("compact", 'p');
 	constexpr auto KeymapPath = Argv::make_Param("keymap", 'k');
+	constexpr auto CompiledKeymapPath = Argv::make_Param("compiled-keymap", 'K');
+	constexpr auto CacheDir = Argv::make_Param("cache-dir", 'C');
+	constexpr auto StatePath = Argv::make_Param("state", 'T');
+	constexpr auto Stats = Argv::make_OptionalParam("stats", 't');
+	constexpr auto TraceMarker = Argv::make_OptionalParam("trace-marker", 'M');
+	constexpr auto Perf = Argv::make_Option("perf", 'P');
+	constexpr auto DaemonMode = Argv::make_Option("daemon", 'd');
+	constexpr auto SocketPath = Argv::make_Param("socket", 's');
+	constexpr auto Send = Argv::make_Param("send", 'S');
+	constexpr auto Key = Argv::make_Param("key", 'y');
+	constexpr auto Backend = Argv::make_Param("backend", 'b');
+	constexpr auto InputPath = Argv::make_Param("input", 'i');
+	constexpr auto HoldMs = Argv::make_Param("hold-ms", 'o');
+	constexpr auto Watch = Argv::make_Option("watch", 'w');
 
 	Argv::GNUOption opts[] = {
-		ClearAll, Help, Meta,
-		KeymapPath,
-		Argv::GNUOptionDone
+		ClearAll, Help, Hide, Meta, Compact, Perf, DaemonMode, Watch,
+		KeymapPath, CompiledKeymapPath, CacheDir, StatePath, SocketPath, Send, Key, Backend, InputPath, HoldMs,
+		Stats, TraceMarker, Argv::GNUOptionDone
 	};
 
 	auto incomingArgv = Argv::IncomingArgv{opts, argc, argv};
@@ -144,17 +265,107 @@ static auto parse_argv(int argc, char** argv)
 		switch (c) {
 
 		case ClearAll.val:
-			clear_all = true;
+			options.clear_all = true;
+			break;
+
+		case Hide.val:
+			options.hide = true;
 			break;
 
 		case Meta.val:
-			meta = true;
+			options.meta = true;
+			break;
+
+		case Compact.val:
+			options.compact = true;
 			break;
 
 		case KeymapPath.val:
-			keymapPath = std::move(opt);
+			options.keymapPath = std::move(opt);
+			break;
+
+		case CompiledKeymapPath.val:
+			options.compiledKeymapPath = std::move(opt);
+			break;
+
+		case CacheDir.val:
+			options.cacheDir = std::move(opt);
 			break;
 
+		case StatePath.val:
+			options.statePath = std::move(opt);
+			break;
+
+		case Stats.val:
+			if (!opt.empty() && (opt != "json")) {
+				fprintf(stderr, "Invalid stats format: %s\n", opt.c_str());
+				usage(argv);
+				exit(1);
+			}
+			options.stats = true;
+			options.statsJson = !opt.empty();
+			break;
+
+		case TraceMarker.val:
+			options.traceMarkerPath = (opt.empty())
+				? std::string{default_trace_marker_path}
+				: std::move(opt);
+			break;
+
+		case Perf.val:
+			options.perfEvents = true;
+			options.stats = true;
+			break;
+
+		case DaemonMode.val:
+			options.daemon = true;
+			break;
+
+		case SocketPath.val:
+			options.socketPath = std::move(opt);
+			break;
+
+		case Send.val:
+			options.sendCommand = std::move(opt);
+			break;
+
+		case Key.val: {
+			auto end = opt.data() + opt.size();
+			auto [ptr, ec] = std::from_chars(opt.data(), end, options.keycode);
+			if ((ec != std::errc{}) || (ptr != end)
+			 || (options.keycode < 1) || (options.keycode > 255)) {
+				fprintf(stderr, "Invalid keycode: %s\n", opt.c_str());
+				usage(argv);
+				exit(1);
+			}
+			break;
+		}
+
+		case Backend.val:
+			options.backend = std::move(opt);
+			break;
+
+		case Watch.val:
+			options.watch = true;
+			options.daemon = true;
+			break;
+
+		case InputPath.val:
+			options.inputPath = std::move(opt);
+			options.daemon = true;
+			break;
+
+		case HoldMs.val: {
+			auto end = opt.data() + opt.size();
+			auto [ptr, ec] = std::from_chars(opt.data(), end, options.holdMs);
+			if ((ec != std::errc{}) || (ptr != end)) {
+				fprintf(stderr, "Invalid hold time: %s\n", opt.c_str());
+				usage(argv);
+				exit(1);
+			}
+			break;
+		}
+
 		case Help.val:
 			usage(argv);
 			exit(0);
@@ -166,66 +377,616 @@ static auto parse_argv(int argc, char** argv)
 		}
 	}
 
+	// Client mode does not touch the device
+	if (!options.sendCommand.empty()) {
+		return options;
+	}
+
+	auto spi_hz = uint32_t{};
+	auto vcom_hz = uint32_t{};
+	auto const in_memory = (options.backend.substr(0, mock_backend_prefix.size()) == mock_backend_prefix)
+		|| parse_sim_backend(options.backend, spi_hz, vcom_hz);
+	if (!in_memory && (options.backend != ioctl_backend)) {
+		fprintf(stderr, "Unknown backend: %s\n", options.backend.c_str());
+		usage(argv);
+		exit(1);
+	}
+
+	// In-memory backend does not need a device
 	auto&& [rest_argc, rest_argv] = incomingArgv.get_rest();
+	if ((rest_argc == 0) && in_memory) {
+		return options;
+	}
 	if (rest_argc == 0) {
 		fprintf(stderr, "Expected sharp_dev argument\n");
 		usage(argv);
 		exit(1);
 	}
 
-	sharpDev = std::string{rest_argv[0]};
+	// Subcommand in place of device
+	if (rest_argv[0] == "compile-keymap"sv) {
+		options.compileKeymap = true;
+		return options;
+	}
+
+	options.sharpDev = std::string{rest_argv[0]};
 
-	return std::make_tuple(clear_all, meta, std::move(keymapPath), std::move(sharpDev));
+	return options;
 }
 
-int main(int argc, char** argv)
+// Load compiled keymap and glyph indices if compiled from the keymap as
+// it is now, with this font
+static std::optional<std::pair<KeymapRender::Keymap, KeymapRender::Glyphs>> load_compiled_keymap(
+	std::string const& keymapPath, std::string const& compiledKeymapPath)
 {
-	// Parse arguments
-	auto&& [clear_all, meta, keymapPath, sharpDev] = parse_argv(argc, argv);
+	auto timer = Profile::Timer{"load_compiled_keymap"};
+
+	try {
+		auto compiledKeymap = CompiledKeymap::load(compiledKeymapPath.c_str());
+		if (!compiledKeymap
+		 || !compiledKeymap->isCurrent(keymapPath.c_str(), fnv1a64(psf_start, psf_size))) {
+			return std::nullopt;
+		}
+
+		auto keymap = KeymapRender::Keymap{};
+		auto glyphs = KeymapRender::Glyphs{};
+		for (auto const& entry : *compiledKeymap) {
+			keymap[entry.keycode] = entry.utf16;
+			glyphs[entry.keycode] = entry.glyph;
+		}
+		return std::make_pair(std::move(keymap), std::move(glyphs));
+
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "Ignoring compiled keymap: %s\n", ex.what());
+		return std::nullopt;
+	}
+}
+
+// Render overlay for Symbol or Meta layer
+static void render_layer(KeymapRender& keymapRender, Control::Layer layer,
+	Options const& options)
+{
+	// Meta mode overlay
+	if (layer == Control::Layer::Meta) {
+
+		keymapRender.render(symkeyMetaMap);
+
+	// Symkey overlay
+	} else {
+
+		// Prefer compiled keymap, skipping text parse, name lookup and
+		// glyph lookup
+		if (auto compiled = load_compiled_keymap(options.keymapPath, options.compiledKeymapPath)) {
+			auto const& [keymap, glyphs] = *compiled;
+			keymapRender.render(keymap, &glyphs);
+		} else {
+			keymapRender.render(parse_symkey_map(options.keymapPath));
+		}
+	}
+}
+
+static auto get_layout(Options const& options)
+{
+	return (options.compact)
+		? KeymapRender::Layout::Compact
+		: KeymapRender::Layout::Full;
+}
+
+// Hash everything the rendered layer depends on
+static std::optional<uint64_t> get_render_key(Control::Layer layer, PixelFormat format,
+	Options const& options)
+{
+	auto const layout = get_layout(options);
+	auto hash = fnv1a64(&KeymapRender::layout_version, sizeof(KeymapRender::layout_version));
+	hash = fnv1a64(&layout, sizeof(layout), hash);
+	hash = fnv1a64(&format, sizeof(format), hash);
+	hash = fnv1a64(&layer, sizeof(layer), hash);
+	hash = fnv1a64(psf_start, psf_size, hash);
+
+	// Built-in Meta keymap
+	if (layer == Control::Layer::Meta) {
+		for (auto const& [symkey, label] : symkeyMetaMap) {
+			auto&& [utf16_1, utf16_2, utf16_3] = label;
+			uint32_t const fields[] = {(uint32_t)symkey, utf16_1, utf16_2, utf16_3};
+			hash = fnv1a64(fields, sizeof(fields), hash);
+		}
+		return hash;
+	}
+
+	// Symbol keymap text, render will report errors if unreadable
+	try {
+		auto keymapFile = KeymapFile{options.keymapPath.c_str()};
+		auto keymapText = keymapFile.get();
+		return fnv1a64(keymapText.data(), keymapText.size(), hash);
+	} catch (std::exception const&) {
+		return std::nullopt;
+	}
+}
+
+static std::optional<RenderCache> open_render_cache(Options const& options)
+{
+	if (options.cacheDir.empty()) {
+		return std::nullopt;
+	}
+
+	try {
+		return RenderCache{options.cacheDir.c_str(), render_cache_size};
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "Render cache disabled: %s\n", ex.what());
+		return std::nullopt;
+	}
+}
+
+// Load rendered layer from cache, or render and store it
+static RenderCache::Bitmap get_layer_bitmap(std::optional<RenderCache>& renderCache,
+	Control::Layer layer, Options const& options)
+{
+	auto const format = PixelFormat::Mono1;
+
+	auto key = (renderCache)
+		? get_render_key(layer, format, options)
+		: std::nullopt;
+	if (key) {
+		auto timer = Profile::Timer{"cache_load"};
+		if (auto bitmap = renderCache->load(*key)) {
+			return std::move(*bitmap);
+		}
+	}
+
+	auto keymapRender = KeymapRender{psf_start, psf_size, format, get_layout(options)};
+	render_layer(keymapRender, layer, options);
+
+	auto pix = keymapRender.get();
+	auto bitmap = RenderCache::Bitmap
+		{ .x = keymapRender.getX()
+		, .y = keymapRender.getY()
+		, .width = keymapRender.getWidth()
+		, .height = keymapRender.getHeight()
+		, .format = format
+		, .pixels = std::vector<unsigned char>(pix,
+			pix + (keymapRender.getPitch() * keymapRender.getHeight()))
+	};
+
+	if (key) {
+		auto timer = Profile::Timer{"cache_store"};
+		try {
+			renderCache->store(*key, bitmap.x, bitmap.y, bitmap.width, bitmap.height,
+				bitmap.format, bitmap.pixels.data());
+		} catch (std::exception const& ex) {
+			fprintf(stderr, "Failed to cache overlay: %s\n", ex.what());
+		}
+	}
+
+	return bitmap;
+}
+
+// Find bitmap rendered at build time for layer and current keymap
+static std::optional<Prerendered::View> find_prerendered(Control::Layer layer,
+	Options const& options)
+{
+	auto timer = Profile::Timer{"check_prerendered"};
+
+	// Only the full layout is rendered at build time
+	if (options.compact) {
+		return std::nullopt;
+	}
+
+	// Meta mode overlay is fixed
+	if (layer == Control::Layer::Meta) {
+		return Prerendered::get_view((unsigned char const*)&_binary_meta_overlay_bin_start,
+			&_binary_meta_overlay_bin_end - &_binary_meta_overlay_bin_start);
+	}
+
+	// Symkey overlay if keymap is unchanged since build
+	auto view = Prerendered::get_view((unsigned char const*)&_binary_symbol_overlay_bin_start,
+		&_binary_symbol_overlay_bin_end - &_binary_symbol_overlay_bin_start);
+	if (!view) {
+		return std::nullopt;
+	}
+	try {
+		auto keymapFile = KeymapFile{options.keymapPath.c_str()};
+		auto keymapText = keymapFile.get();
+		if (fnv1a64(keymapText.data(), keymapText.size()) != view->keymapHash) {
+			return std::nullopt;
+		}
+	} catch (std::exception const&) {
+		return std::nullopt;
+	}
+
+	return view;
+}
+
+static SharpSession make_session(Options const& options)
+{
+	if (options.backend.substr(0, mock_backend_prefix.size()) == mock_backend_prefix) {
+		auto dump_path = options.backend.substr(mock_backend_prefix.size());
+		return SharpSession{std::make_unique<MockBackend>(dump_path.c_str())};
+	}
+
+	auto spi_hz = uint32_t{};
+	auto vcom_hz = uint32_t{};
+	if (parse_sim_backend(options.backend, spi_hz, vcom_hz)) {
+		return SharpSession{std::make_unique<LcdSimBackend>(spi_hz, vcom_hz)};
+	}
+
+	return SharpSession{options.sharpDev.c_str()};
+}
+
+static SharpSession open_session(Options const& options)
+{
+	auto timer = Profile::Timer{"open_device"};
+	auto session = make_session(options);
+
+	if (!options.traceMarkerPath.empty()
+	 && !session.enableTrace(options.traceMarkerPath.c_str())) {
+		fprintf(stderr, "Trace markers disabled: %s: %s\n", options.traceMarkerPath.c_str(),
+			::strerror(errno));
+	}
+
+	return session;
+}
+
+// Handles only persist across runs on a real driver
+static std::optional<OverlayState> open_overlay_state(Options const& options)
+{
+	if (options.statePath.empty() || (options.backend != ioctl_backend)) {
+		return std::nullopt;
+	}
+
+	auto timer = Profile::Timer{"load_state"};
+	try {
+		return OverlayState{options.statePath.c_str(), options.sharpDev.c_str()};
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "Overlay state disabled: %s\n", ex.what());
+		return std::nullopt;
+	}
+}
+
+// Hide overlay recorded in state entry, keeping its storage
+static void hide_entry(SharpSession& session, OverlayState::Entry& entry)
+{
+	if (entry.display == 0) {
+		return;
+	}
+
+	auto overlay = Overlay{session, (void*)entry.storage, (void*)entry.display};
+	try {
+		overlay.hide();
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "Dropping stale overlay: %s\n", ex.what());
+		overlay.eject();
+		entry = OverlayState::Entry{};
+		return;
+	}
+	overlay.eject();
+	entry.display = 0;
+}
+
+// Hide and free overlay recorded in state entry
+static void remove_entry(SharpSession& session, OverlayState::Entry& entry)
+{
+	if (entry.storage != 0) {
+		auto overlay = Overlay{session, (void*)entry.storage, (void*)entry.display};
+		try {
+			overlay.remove();
+		} catch (std::exception const& ex) {
+			fprintf(stderr, "Dropping stale overlay: %s\n", ex.what());
+			overlay.eject();
+		}
+	}
+	entry = OverlayState::Entry{};
+}
+
+// Add overlay and display it. With state, an identical overlay from
+// an earlier run is shown again instead of re-added, a different one
+// is freed, and other layers are hidden
+static void show_layer(SharpSession& session, std::optional<OverlayState>& state,
+	Control::Layer layer, int x, int y, size_t width, size_t height, unsigned char const* pix,
+	PixelFormat format)
+{
+	auto const size = get_pitch(format, width) * height;
+
+	// Detach and leave cleanup to --clear-all
+	if (!state) {
+		auto overlay = Overlay{session, x, y, width, height, pix, format};
+		overlay.show();
+		overlay.eject();
+		return;
+	}
+
+	uint64_t const params[] = {(uint64_t)x, (uint64_t)y, width, height, (uint64_t)format};
+	auto const contentHash = fnv1a64(pix, size, fnv1a64(params, sizeof(params)));
+
+	// Adopt recorded overlays, handed back to state after commit
+	auto overlays = std::array<std::optional<Overlay>, Control::num_layers>{};
+	for (size_t i = 0; i < Control::num_layers; i++) {
+		auto const& entry = state->get((Control::Layer)i);
+		overlays[i].emplace(session, (void*)entry.storage, (void*)entry.display);
+	}
+	auto& overlay = *overlays[(size_t)layer];
+	auto const old_storage = overlay.getStorage();
+	auto const changed = (old_storage == nullptr)
+		|| (state->get(layer).contentHash != contentHash);
+
+	// Swap in changed content and hide other layers with one redraw.
+	// Old storage is freed after saving state
+	auto transaction = OverlayTransaction{session};
+	if (changed) {
+		transaction.replace(overlay, x, y, width, height, pix, format);
+	}
+	transaction.show(overlay);
+	for (size_t i = 0; i < Control::num_layers; i++) {
+		if ((i != (size_t)layer) && overlays[i]->isShown()) {
+			transaction.hide(*overlays[i]);
+		}
+	}
+	auto error = std::string{};
+	try {
+		transaction.commit();
+	} catch (std::exception const& ex) {
+		error = ex.what();
+	}
+
+	auto const shown = overlay.isShown();
+	auto const replaced = changed && (overlay.getStorage() != old_storage);
+
+	// Record handles, other layers that failed to hide are stale
+	for (size_t i = 0; i < Control::num_layers; i++) {
+		auto& entry = state->get((Control::Layer)i);
+		if ((i != (size_t)layer) && overlays[i]->isShown()) {
+			fprintf(stderr, "Dropping stale overlay: %s\n", error.c_str());
+			entry = OverlayState::Entry{};
+		} else {
+			entry.storage = (uint64_t)overlays[i]->getStorage();
+			entry.display = (uint64_t)overlays[i]->getDisplay();
+		}
+		overlays[i]->eject();
+	}
+	if (replaced) {
+		state->get(layer).contentHash = contentHash;
+	}
+
+	{
+		auto timer = Profile::Timer{"save_state"};
+		state->save();
+	}
+	session.flushRemovals();
+
+	if ((changed && !replaced) || !shown) {
+		throw std::runtime_error("failed to show overlay: " + error);
+	}
+}
+
+// Resolve text keymap to keycode, UTF-16 and glyph table
+static int compile_keymap(Options const& options)
+{
+	// Source is identified as it was before reading, a concurrent edit
+	// leaves the compiled keymap stale rather than wrong
+	struct stat keymap_st{};
+	if (::stat(options.keymapPath.c_str(), &keymap_st) < 0) {
+		fprintf(stderr, "Failed to compile keymap: %s: %s\n",
+			options.keymapPath.c_str(), ::strerror(errno));
+		return 1;
+	}
+
+	try {
+		// Hash the same text that is parsed
+		auto keymapFile = KeymapFile{options.keymapPath.c_str()};
+		auto keymapText = keymapFile.get();
+		auto keymap = resolve_symkey_map(keymapFile.parse());
+
+		auto psf = PSF{psf_start, psf_size};
+		auto entries = std::vector<CompiledKeymap::Entry>{};
+		for (auto const& [keycode, utf16] : keymap) {
+			entries.push_back(CompiledKeymap::Entry{(uint16_t)keycode, utf16,
+				psf.getGlyphIndex(utf16), 0});
+		}
+		std::sort(entries.begin(), entries.end(), [](auto const& a, auto const& b) {
+			return a.keycode < b.keycode;
+		});
+
+		CompiledKeymap::write(options.compiledKeymapPath.c_str(),
+			CompiledKeymap::make_Header(options.keymapPath.c_str(), keymap_st,
+				fnv1a64(keymapText.data(), keymapText.size()),
+				fnv1a64(psf_start, psf_size)),
+			entries);
+
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "Failed to compile keymap: %s\n", ex.what());
+		return 1;
+	}
+
+	return 0;
+}
+
+// One line per latency, in nanoseconds for scripts
+static void print_daemon_stats(Control::StatsPayload const& stats)
+{
+	printf("period_ns %llu\n", (unsigned long long)stats.periodNs);
+	printf("%-16s %8s %12s %12s %12s %12s %12s\n",
+		"latency", "count", "min_ns", "p50_ns", "p90_ns", "p99_ns", "max_ns");
+	for (size_t i = 0; i < Control::num_latencies; i++) {
+		auto const& summary = stats.latencies[i];
+		printf("%-16s %8llu %12llu %12llu %12llu %12llu %12llu\n", Control::latency_names[i],
+			(unsigned long long)summary.count, (unsigned long long)summary.minNs,
+			(unsigned long long)summary.p50Ns, (unsigned long long)summary.p90Ns,
+			(unsigned long long)summary.p99Ns, (unsigned long long)summary.maxNs);
+	}
+}
+
+// Forward command to running daemon
+static int send_command(Options const& options)
+{
+	static const auto commands = std::map<std::string, Control::Command>
+		{ {"show", Control::Command::Show}
+		, {"hide", Control::Command::Hide}
+		, {"clear", Control::Command::Clear}
+		, {"reload", Control::Command::Reload}
+		, {"highlight", Control::Command::Highlight}
+		, {"unhighlight", Control::Command::Unhighlight}
+		, {"stats", Control::Command::Stats}
+		, {"reset-stats", Control::Command::ResetStats}
+	};
+
+	auto command = commands.find(options.sendCommand);
+	if (command == commands.end()) {
+		fprintf(stderr, "Unknown command: %s\n", options.sendCommand.c_str());
+		return 1;
+	}
+
+	auto client = Control::Client{options.socketPath.c_str()};
+	auto stats = Control::StatsPayload{};
+	auto reply = client.send(Control::make_Request(command->second,
+		(options.meta) ? Control::Layer::Meta : Control::Layer::Symbol, options.keycode),
+		&stats, (command->second == Control::Command::Stats) ? sizeof(stats) : 0);
+	if (reply.error != 0) {
+		fprintf(stderr, "Daemon failed %s: %s\n", options.sendCommand.c_str(),
+			::strerror(reply.error));
+		return 1;
+	}
+
+	if (command->second == Control::Command::Stats) {
+		print_daemon_stats(stats);
+	}
+
+	return 0;
+}
+
+static int run(Options const& options)
+{
+	// Send to daemon and exit
+	if (!options.sendCommand.empty()) {
+		return send_command(options);
+	}
+
+	// Compile keymap and exit
+	if (options.compileKeymap) {
+		return compile_keymap(options);
+	}
 
 	// Clear and exit
-	if (clear_all) {
-		auto session = SharpSession{sharpDev.c_str()};
+	if (options.clear_all) {
+		auto session = open_session(options);
+		auto state = open_overlay_state(options);
 		Overlay::clear_all(session);
+		if (state) {
+			state->reset();
+			state->save();
+		}
 		return 0;
 	}
 
-	// Create keymap render
-	auto keymapRender = [&]() {
-
-		// Meta mode overlay
-		if (meta) {
+	auto const layer = (options.meta) ? Control::Layer::Meta : Control::Layer::Symbol;
 
-			return KeymapRender{psf_start, psf_size, symkeyMetaMap};
+	// Hide recorded overlay and exit
+	if (options.hide) {
+		auto session = open_session(options);
+		auto state = open_overlay_state(options);
+		if (!state) {
+			fprintf(stderr, "No overlay state to hide from\n");
+			return 1;
+		}
+		hide_entry(session, state->get(layer));
+		state->save();
+		return 0;
+	}
 
-		// Symkey overlay
-		} else {
+	// Serve commands until terminated
+	if (options.daemon) {
+		auto session = open_session(options);
 
-			// Parse keymap
-			auto symkeyX11names = parse_keymap(keymapPath.c_str());
-
-			// Build symkey map
-			auto keymap = KeymapRender::Keymap{};
-			for (auto const& [symkey, x11name] : symkeyX11names) {
-				auto sym_utf16 = x11name_to_utf16(x11name);
-				if (sym_utf16 == 0x0) {
-					continue;
-				}
-				keymap[symkey] = sym_utf16;
+		// Free overlays left by one-shot runs
+		if (auto state = open_overlay_state(options)) {
+			for (size_t i = 0; i < Control::num_layers; i++) {
+				remove_entry(session, state->get((Control::Layer)i));
 			}
+			state->save();
+		}
 
-			return KeymapRender{psf_start, psf_size, keymap};
+		// Renderers and their cell atlases live as long as the daemon, one
+		// per layer so highlights can be cut from either. The PSF glyph
+		// cache only serves Gray8, Mono1 rows at label scales are a table
+		// lookup already
+		auto symbolRender = KeymapRender{psf_start, psf_size, PixelFormat::Mono1,
+			get_layout(options)};
+		auto metaRender = KeymapRender{psf_start, psf_size, PixelFormat::Mono1,
+			get_layout(options)};
+
+		auto daemon = Daemon{session, options.socketPath.c_str(),
+			[&options, &symbolRender, &metaRender](Control::Layer layer) -> KeymapRender const& {
+				auto& keymapRender = (layer == Control::Layer::Meta) ? metaRender : symbolRender;
+				render_layer(keymapRender, layer, options);
+				return keymapRender;
+			}
+		};
+		if (options.watch) {
+			daemon.watchKeymap(options.keymapPath.c_str());
 		}
-	}();
+		if (!options.inputPath.empty()) {
+			daemon.attachInput(std::make_unique<KeyInput>(options.inputPath.c_str()),
+				Daemon::KeyConfig
+					{ .layerKeycodes = {SYMBOL_KEYCODE, META_KEYCODE}
+					, .holdNs = (uint64_t)options.holdMs * 1000000
+					, .reportLatency = options.stats
+				});
+		}
+		daemon.run();
+		return 0;
+	}
 
-	// Send overlay to driver
-	auto session = SharpSession{sharpDev.c_str()};
-	auto overlay = Overlay{session, 0, -(int)keymapRender.getHeight(),
-		keymapRender.getWidth(), keymapRender.getHeight(), keymapRender.get()};
+	auto session = open_session(options);
+	auto state = open_overlay_state(options);
 
-	// Display and detach overlay
-	overlay.show();
-	overlay.eject();
+	// Send build-time render straight to driver
+	if (auto prerendered = find_prerendered(layer, options)) {
+		// Full layout sits at bottom left
+		show_layer(session, state, layer, 0, -(int)prerendered->height,
+			prerendered->width, prerendered->height,
+			prerendered->pixels, prerendered->format);
+		return 0;
+	}
+
+	// Load cached render or render keymap
+	auto renderCache = open_render_cache(options);
+	auto bitmap = get_layer_bitmap(renderCache, layer, options);
+	show_layer(session, state, layer, bitmap.x, bitmap.y, bitmap.width, bitmap.height,
+		bitmap.pixels.data(), bitmap.format);
+
+	if (options.stats && renderCache) {
+		auto const& stats = renderCache->getStats();
+		Profile::set_counter("render_cache_hits", stats.hits);
+		Profile::set_counter("render_cache_misses", stats.misses);
+		Profile::set_counter("render_cache_evictions", stats.evictions);
+	}
 
 	return 0;
 }
+
+int main(int argc, char** argv)
+{
+	auto const main_ns = Profile::now_ns();
+
+	// Parse arguments
+	auto const options = parse_argv(argc, argv);
+	if (options.stats) {
+		Profile::enable(main_ns);
+	}
+	if (options.perfEvents && !Profile::enable_events()) {
+		fprintf(stderr, "CPU event counters unavailable: %s\n", ::strerror(errno));
+	}
+
+	// Report setup failures, e.g. a daemon already running, rather than abort
+	auto result = 1;
+	try {
+		result = run(options);
+	} catch (std::exception const& ex) {
+		fprintf(stderr, "%s\n", ex.what());
+	}
+
+	// JSON alone on stdout for collection
+	if (options.stats) {
+		Profile::print((options.statsJson) ? stdout : stderr, options.statsJson);
+	}
+
+	return result;
+}
@@ -1,1797 +1,2287 @@
+// Generated by x11map.cpp, do not edit
+
 #include <cstdint>
 
-#include <string>
-#include <unordered_map>
+#include <string_view>
 
-static const auto x11nameUtf16Map1 = std::unordered_map<std::string, uint16_t>
-{ { "0", 0x30 }
-, { "1", 0x31 }
-, { "2", 0x32 }
-, { "3", 0x33 }
-, { "4", 0x34 }
-, { "5", 0x35 }
-, { "6", 0x36 }
-, { "7", 0x37 }
-, { "8", 0x38 }
-, { "9", 0x39 }
-, { "A", 0x41 }
-, { "a", 0x61 }
-, { "Aacute", 0xc1 }
-, { "aacute", 0xe1 }
-, { "Abelowdot", 0x1ea0 }
-, { "abelowdot", 0x1ea1 }
-, { "abovedot", 0x2d9 }
-, { "Abreve", 0x102 }
-, { "abreve", 0x103 }
-, { "Abreveacute", 0x1eae }
-, { "abreveacute", 0x1eaf }
-, { "Abrevebelowdot", 0x1eb6 }
-, { "abrevebelowdot", 0x1eb7 }
-, { "Abrevegrave", 0x1eb0 }
-, { "abrevegrave", 0x1eb1 }
-, { "Abrevehook", 0x1eb2 }
-, { "abrevehook", 0x1eb3 }
-, { "Abrevetilde", 0x1eb4 }
-, { "abrevetilde", 0x1eb5 }
-, { "Acircumflex", 0xc2 }
-, { "acircumflex", 0xe2 }
-, { "Acircumflexacute", 0x1ea4 }
-, { "acircumflexacute", 0x1ea5 }
-, { "Acircumflexbelowdot", 0x1eac }
-, { "acircumflexbelowdot", 0x1ead }
-, { "Acircumflexgrave", 0x1ea6 }
-, { "acircumflexgrave", 0x1ea7 }
-, { "Acircumflexhook", 0x1ea8 }
-, { "acircumflexhook", 0x1ea9 }
-, { "Acircumflextilde", 0x1eaa }
-, { "acircumflextilde", 0x1eab }
-, { "acute", 0xb4 }
-, { "Adiaeresis", 0xc4 }
-, { "adiaeresis", 0xe4 }
-, { "AE", 0xc6 }
-, { "ae", 0xe6 }
-, { "Agrave", 0xc0 }
-, { "agrave", 0xe0 }
-, { "Ahook", 0x1ea2 }
-, { "ahook", 0x1ea3 }
-, { "Amacron", 0x100 }
-, { "amacron", 0x101 }
-, { "ampersand", 0x26 }
-, { "Aogonek", 0x104 }
-, { "aogonek", 0x105 }
-, { "apostrophe", 0x27 }
-, { "approxeq", 0x2248 }
-, { "approximate", 0x223c }
-, { "Arabic_0", 0x660 }
-, { "Arabic_1", 0x661 }
-, { "Arabic_2", 0x662 }
-, { "Arabic_3", 0x663 }
-, { "Arabic_4", 0x664 }
-, { "Arabic_5", 0x665 }
-, { "Arabic_6", 0x666 }
-, { "Arabic_7", 0x667 }
-, { "Arabic_8", 0x668 }
-, { "Arabic_9", 0x669 }
-, { "Arabic_ain", 0x639 }
-, { "Arabic_alef", 0x627 }
-, { "Arabic_alefmaksura", 0x649 }
-, { "Arabic_beh", 0x628 }
-, { "Arabic_comma", 0x60c }
-, { "Arabic_dad", 0x636 }
-, { "Arabic_dal", 0x62f }
-, { "Arabic_damma", 0x64f }
-, { "Arabic_dammatan", 0x64c }
-, { "Arabic_ddal", 0x688 }
-, { "Arabic_farsi_yeh", 0x6cc }
-, { "Arabic_fatha", 0x64e }
-, { "Arabic_fathatan", 0x64b }
-, { "Arabic_feh", 0x641 }
-, { "Arabic_fullstop", 0x6d4 }
-, { "Arabic_gaf", 0x6af }
-, { "Arabic_ghain", 0x63a }
-, { "Arabic_ha", 0x647 }
-, { "Arabic_hah", 0x62d }
-, { "Arabic_hamza", 0x621 }
-, { "Arabic_hamza_above", 0x654 }
-, { "Arabic_hamza_below", 0x655 }
-, { "Arabic_hamzaonalef", 0x623 }
-, { "Arabic_hamzaonwaw", 0x624 }
-, { "Arabic_hamzaonyeh", 0x626 }
-, { "Arabic_hamzaunderalef", 0x625 }
-, { "Arabic_heh", 0x647 }
-, { "Arabic_heh_doachashmee", 0x6be }
-, { "Arabic_heh_goal", 0x6c1 }
-, { "Arabic_jeem", 0x62c }
-, { "Arabic_jeh", 0x698 }
-, { "Arabic_kaf", 0x643 }
-, { "Arabic_kasra", 0x650 }
-, { "Arabic_kasratan", 0x64d }
-, { "Arabic_keheh", 0x6a9 }
-, { "Arabic_khah", 0x62e }
-, { "Arabic_lam", 0x644 }
-, { "Arabic_madda_above", 0x653 }
-, { "Arabic_maddaonalef", 0x622 }
-, { "Arabic_meem", 0x645 }
-, { "Arabic_noon", 0x646 }
-, { "Arabic_noon_ghunna", 0x6ba }
-, { "Arabic_peh", 0x67e }
-, { "Arabic_percent", 0x66a }
-, { "Arabic_qaf", 0x642 }
-, { "Arabic_question_mark", 0x61f }
-, { "Arabic_ra", 0x631 }
-, { "Arabic_rreh", 0x691 }
-, { "Arabic_sad", 0x635 }
-, { "Arabic_seen", 0x633 }
-, { "Arabic_semicolon", 0x61b }
-, { "Arabic_shadda", 0x651 }
-, { "Arabic_sheen", 0x634 }
-, { "Arabic_sukun", 0x652 }
-, { "Arabic_superscript_alef", 0x670 }
-, { "Arabic_tah", 0x637 }
-, { "Arabic_tatweel", 0x640 }
-, { "Arabic_tcheh", 0x686 }
-, { "Arabic_teh", 0x62a }
-, { "Arabic_tehmarbuta", 0x629 }
-, { "Arabic_thal", 0x630 }
-, { "Arabic_theh", 0x62b }
-, { "Arabic_tteh", 0x679 }
-, { "Arabic_veh", 0x6a4 }
-, { "Arabic_waw", 0x648 }
-, { "Arabic_yeh", 0x64a }
-, { "Arabic_yeh_baree", 0x6d2 }
-, { "Arabic_zah", 0x638 }
-, { "Arabic_zain", 0x632 }
-, { "Aring", 0xc5 }
-, { "aring", 0xe5 }
-, { "Armenian_accent", 0x55b }
-, { "Armenian_amanak", 0x55c }
-, { "Armenian_apostrophe", 0x55a }
-, { "Armenian_AT", 0x538 }
-, { "Armenian_at", 0x568 }
-, { "Armenian_AYB", 0x531 }
-, { "Armenian_ayb", 0x561 }
-, { "Armenian_BEN", 0x532 }
-, { "Armenian_ben", 0x562 }
-, { "Armenian_but", 0x55d }
-, { "Armenian_CHA", 0x549 }
-, { "Armenian_cha", 0x579 }
-, { "Armenian_DA", 0x534 }
-, { "Armenian_da", 0x564 }
-, { "Armenian_DZA", 0x541 }
-, { "Armenian_dza", 0x571 }
-, { "Armenian_E", 0x537 }
-, { "Armenian_e", 0x567 }
-, { "Armenian_exclam", 0x55c }
-, { "Armenian_FE", 0x556 }
-, { "Armenian_fe", 0x586 }
-, { "Armenian_full_stop", 0x589 }
-, { "Armenian_GHAT", 0x542 }
-, { "Armenian_ghat", 0x572 }
-, { "Armenian_GIM", 0x533 }
-, { "Armenian_gim", 0x563 }
-, { "Armenian_HI", 0x545 }
-, { "Armenian_hi", 0x575 }
-, { "Armenian_HO", 0x540 }
-, { "Armenian_ho", 0x570 }
-, { "Armenian_hyphen", 0x58a }
-, { "Armenian_INI", 0x53b }
-, { "Armenian_ini", 0x56b }
-, { "Armenian_JE", 0x54b }
-, { "Armenian_je", 0x57b }
-, { "Armenian_KE", 0x554 }
-, { "Armenian_ke", 0x584 }
-, { "Armenian_KEN", 0x53f }
-, { "Armenian_ken", 0x56f }
-, { "Armenian_KHE", 0x53d }
-, { "Armenian_khe", 0x56d }
-, { "Armenian_ligature_ew", 0x587 }
-, { "Armenian_LYUN", 0x53c }
-, { "Armenian_lyun", 0x56c }
-, { "Armenian_MEN", 0x544 }
-, { "Armenian_men", 0x574 }
-, { "Armenian_NU", 0x546 }
-, { "Armenian_nu", 0x576 }
-, { "Armenian_O", 0x555 }
-, { "Armenian_o", 0x585 }
-, { "Armenian_paruyk", 0x55e }
-, { "Armenian_PE", 0x54a }
-, { "Armenian_pe", 0x57a }
-, { "Armenian_PYUR", 0x553 }
-, { "Armenian_pyur", 0x583 }
-, { "Armenian_question", 0x55e }
-, { "Armenian_RA", 0x54c }
-, { "Armenian_ra", 0x57c }
-, { "Armenian_RE", 0x550 }
-, { "Armenian_re", 0x580 }
-, { "Armenian_SE", 0x54d }
-, { "Armenian_se", 0x57d }
-, { "Armenian_separation_mark", 0x55d }
-, { "Armenian_SHA", 0x547 }
-, { "Armenian_sha", 0x577 }
-, { "Armenian_shesht", 0x55b }
-, { "Armenian_TCHE", 0x543 }
-, { "Armenian_tche", 0x573 }
-, { "Armenian_TO", 0x539 }
-, { "Armenian_to", 0x569 }
-, { "Armenian_TSA", 0x53e }
-, { "Armenian_tsa", 0x56e }
-, { "Armenian_TSO", 0x551 }
-, { "Armenian_tso", 0x581 }
-, { "Armenian_TYUN", 0x54f }
-, { "Armenian_tyun", 0x57f }
-, { "Armenian_verjaket", 0x589 }
-, { "Armenian_VEV", 0x54e }
-, { "Armenian_vev", 0x57e }
-, { "Armenian_VO", 0x548 }
-, { "Armenian_vo", 0x578 }
-, { "Armenian_VYUN", 0x552 }
-, { "Armenian_vyun", 0x582 }
-, { "Armenian_YECH", 0x535 }
-, { "Armenian_yech", 0x565 }
-, { "Armenian_yentamna", 0x58a }
-, { "Armenian_ZA", 0x536 }
-, { "Armenian_za", 0x566 }
-, { "Armenian_ZHE", 0x53a }
-, { "Armenian_zhe", 0x56a }
-, { "asciicircum", 0x5e }
-, { "asciitilde", 0x7e }
-, { "asterisk", 0x2a }
-, { "at", 0x40 }
-, { "Atilde", 0xc3 }
-, { "atilde", 0xe3 }
-, { "B", 0x42 }
-, { "b", 0x62 }
-, { "Babovedot", 0x1e02 }
-, { "babovedot", 0x1e03 }
-, { "backslash", 0x5c }
-, { "BackSpace", 0x8 }
-, { "ballotcross", 0x2717 }
-, { "bar", 0x7c }
-, { "because", 0x2235 }
-, { "botintegral", 0x2321 }
-, { "botleftparens", 0x239d }
-, { "botleftsqbracket", 0x23a3 }
-, { "botrightparens", 0x23a0 }
-, { "botrightsqbracket", 0x23a6 }
-, { "bott", 0x2534 }
-, { "braceleft", 0x7b }
-, { "braceright", 0x7d }
-, { "bracketleft", 0x5b }
-, { "bracketright", 0x5d }
-, { "braille_blank", 0x2800 }
-, { "braille_dots_1", 0x2801 }
-, { "braille_dots_12", 0x2803 }
-, { "braille_dots_123", 0x2807 }
-, { "braille_dots_1234", 0x280f }
-, { "braille_dots_12345", 0x281f }
-, { "braille_dots_123456", 0x283f }
-, { "braille_dots_1234567", 0x287f }
-, { "braille_dots_12345678", 0x28ff }
-, { "braille_dots_1234568", 0x28bf }
-, { "braille_dots_123457", 0x285f }
-, { "braille_dots_1234578", 0x28df }
-, { "braille_dots_123458", 0x289f }
-, { "braille_dots_12346", 0x282f }
-, { "braille_dots_123467", 0x286f }
-, { "braille_dots_1234678", 0x28ef }
-, { "braille_dots_123468", 0x28af }
-, { "braille_dots_12347", 0x284f }
-, { "braille_dots_123478", 0x28cf }
-, { "braille_dots_12348", 0x288f }
-, { "braille_dots_1235", 0x2817 }
-, { "braille_dots_12356", 0x2837 }
-, { "braille_dots_123567", 0x2877 }
-, { "braille_dots_1235678", 0x28f7 }
-, { "braille_dots_123568", 0x28b7 }
-, { "braille_dots_12357", 0x2857 }
-, { "braille_dots_123578", 0x28d7 }
-, { "braille_dots_12358", 0x2897 }
-, { "braille_dots_1236", 0x2827 }
-, { "braille_dots_12367", 0x2867 }
-, { "braille_dots_123678", 0x28e7 }
-, { "braille_dots_12368", 0x28a7 }
-, { "braille_dots_1237", 0x2847 }
-, { "braille_dots_12378", 0x28c7 }
-, { "braille_dots_1238", 0x2887 }
-, { "braille_dots_124", 0x280b }
-, { "braille_dots_1245", 0x281b }
-, { "braille_dots_12456", 0x283b }
-, { "braille_dots_124567", 0x287b }
-, { "braille_dots_1245678", 0x28fb }
-, { "braille_dots_124568", 0x28bb }
-, { "braille_dots_12457", 0x285b }
-, { "braille_dots_124578", 0x28db }
-, { "braille_dots_12458", 0x289b }
-, { "braille_dots_1246", 0x282b }
-, { "braille_dots_12467", 0x286b }
-, { "braille_dots_124678", 0x28eb }
-, { "braille_dots_12468", 0x28ab }
-, { "braille_dots_1247", 0x284b }
-, { "braille_dots_12478", 0x28cb }
-, { "braille_dots_1248", 0x288b }
-, { "braille_dots_125", 0x2813 }
-, { "braille_dots_1256", 0x2833 }
-, { "braille_dots_12567", 0x2873 }
-, { "braille_dots_125678", 0x28f3 }
-, { "braille_dots_12568", 0x28b3 }
-, { "braille_dots_1257", 0x2853 }
-, { "braille_dots_12578", 0x28d3 }
-, { "braille_dots_1258", 0x2893 }
-, { "braille_dots_126", 0x2823 }
-, { "braille_dots_1267", 0x2863 }
-, { "braille_dots_12678", 0x28e3 }
-, { "braille_dots_1268", 0x28a3 }
-, { "braille_dots_127", 0x2843 }
-, { "braille_dots_1278", 0x28c3 }
-, { "braille_dots_128", 0x2883 }
-, { "braille_dots_13", 0x2805 }
-, { "braille_dots_134", 0x280d }
-, { "braille_dots_1345", 0x281d }
-, { "braille_dots_13456", 0x283d }
-, { "braille_dots_134567", 0x287d }
-, { "braille_dots_1345678", 0x28fd }
-, { "braille_dots_134568", 0x28bd }
-, { "braille_dots_13457", 0x285d }
-, { "braille_dots_134578", 0x28dd }
-, { "braille_dots_13458", 0x289d }
-, { "braille_dots_1346", 0x282d }
-, { "braille_dots_13467", 0x286d }
-, { "braille_dots_134678", 0x28ed }
-, { "braille_dots_13468", 0x28ad }
-, { "braille_dots_1347", 0x284d }
-, { "braille_dots_13478", 0x28cd }
-, { "braille_dots_1348", 0x288d }
-, { "braille_dots_135", 0x2815 }
-, { "braille_dots_1356", 0x2835 }
-, { "braille_dots_13567", 0x2875 }
-, { "braille_dots_135678", 0x28f5 }
-, { "braille_dots_13568", 0x28b5 }
-, { "braille_dots_1357", 0x2855 }
-, { "braille_dots_13578", 0x28d5 }
-, { "braille_dots_1358", 0x2895 }
-, { "braille_dots_136", 0x2825 }
-, { "braille_dots_1367", 0x2865 }
-, { "braille_dots_13678", 0x28e5 }
-, { "braille_dots_1368", 0x28a5 }
-, { "braille_dots_137", 0x2845 }
-, { "braille_dots_1378", 0x28c5 }
-, { "braille_dots_138", 0x2885 }
-, { "braille_dots_14", 0x2809 }
-, { "braille_dots_145", 0x2819 }
-, { "braille_dots_1456", 0x2839 }
-, { "braille_dots_14567", 0x2879 }
-, { "braille_dots_145678", 0x28f9 }
-, { "braille_dots_14568", 0x28b9 }
-, { "braille_dots_1457", 0x2859 }
-, { "braille_dots_14578", 0x28d9 }
-, { "braille_dots_1458", 0x2899 }
-, { "braille_dots_146", 0x2829 }
-, { "braille_dots_1467", 0x2869 }
-, { "braille_dots_14678", 0x28e9 }
-, { "braille_dots_1468", 0x28a9 }
-, { "braille_dots_147", 0x2849 }
-, { "braille_dots_1478", 0x28c9 }
-, { "braille_dots_148", 0x2889 }
-, { "braille_dots_15", 0x2811 }
-, { "braille_dots_156", 0x2831 }
-, { "braille_dots_1567", 0x2871 }
-, { "braille_dots_15678", 0x28f1 }
-, { "braille_dots_1568", 0x28b1 }
-, { "braille_dots_157", 0x2851 }
-, { "braille_dots_1578", 0x28d1 }
-, { "braille_dots_158", 0x2891 }
-, { "braille_dots_16", 0x2821 }
-, { "braille_dots_167", 0x2861 }
-, { "braille_dots_1678", 0x28e1 }
-, { "braille_dots_168", 0x28a1 }
-, { "braille_dots_17", 0x2841 }
-, { "braille_dots_178", 0x28c1 }
-, { "braille_dots_18", 0x2881 }
-, { "braille_dots_2", 0x2802 }
-, { "braille_dots_23", 0x2806 }
-, { "braille_dots_234", 0x280e }
-, { "braille_dots_2345", 0x281e }
-, { "braille_dots_23456", 0x283e }
-, { "braille_dots_234567", 0x287e }
-, { "braille_dots_2345678", 0x28fe }
-, { "braille_dots_234568", 0x28be }
-, { "braille_dots_23457", 0x285e }
-, { "braille_dots_234578", 0x28de }
-, { "braille_dots_23458", 0x289e }
-, { "braille_dots_2346", 0x282e }
-, { "braille_dots_23467", 0x286e }
-, { "braille_dots_234678", 0x28ee }
-, { "braille_dots_23468", 0x28ae }
-, { "braille_dots_2347", 0x284e }
-, { "braille_dots_23478", 0x28ce }
-, { "braille_dots_2348", 0x288e }
-, { "braille_dots_235", 0x2816 }
-, { "braille_dots_2356", 0x2836 }
-, { "braille_dots_23567", 0x2876 }
-, { "braille_dots_235678", 0x28f6 }
-, { "braille_dots_23568", 0x28b6 }
-, { "braille_dots_2357", 0x2856 }
-, { "braille_dots_23578", 0x28d6 }
-, { "braille_dots_2358", 0x2896 }
-, { "braille_dots_236", 0x2826 }
-, { "braille_dots_2367", 0x2866 }
-, { "braille_dots_23678", 0x28e6 }
-, { "braille_dots_2368", 0x28a6 }
-, { "braille_dots_237", 0x2846 }
-, { "braille_dots_2378", 0x28c6 }
-, { "braille_dots_238", 0x2886 }
-, { "braille_dots_24", 0x280a }
-, { "braille_dots_245", 0x281a }
-, { "braille_dots_2456", 0x283a }
-, { "braille_dots_24567", 0x287a }
-, { "braille_dots_245678", 0x28fa }
-, { "braille_dots_24568", 0x28ba }
-, { "braille_dots_2457", 0x285a }
-, { "braille_dots_24578", 0x28da }
-, { "braille_dots_2458", 0x289a }
-, { "braille_dots_246", 0x282a }
-, { "braille_dots_2467", 0x286a }
-, { "braille_dots_24678", 0x28ea }
-, { "braille_dots_2468", 0x28aa }
-, { "braille_dots_247", 0x284a }
-, { "braille_dots_2478", 0x28ca }
-, { "braille_dots_248", 0x288a }
-, { "braille_dots_25", 0x2812 }
-, { "braille_dots_256", 0x2832 }
-, { "braille_dots_2567", 0x2872 }
-, { "braille_dots_25678", 0x28f2 }
-, { "braille_dots_2568", 0x28b2 }
-, { "braille_dots_257", 0x2852 }
-, { "braille_dots_2578", 0x28d2 }
-, { "braille_dots_258", 0x2892 }
-, { "braille_dots_26", 0x2822 }
-, { "braille_dots_267", 0x2862 }
-, { "braille_dots_2678", 0x28e2 }
-, { "braille_dots_268", 0x28a2 }
-, { "braille_dots_27", 0x2842 }
-, { "braille_dots_278", 0x28c2 }
-, { "braille_dots_28", 0x2882 }
-, { "braille_dots_3", 0x2804 }
-, { "braille_dots_34", 0x280c }
-, { "braille_dots_345", 0x281c }
-, { "braille_dots_3456", 0x283c }
-, { "braille_dots_34567", 0x287c }
-, { "braille_dots_345678", 0x28fc }
-, { "braille_dots_34568", 0x28bc }
-, { "braille_dots_3457", 0x285c }
-, { "braille_dots_34578", 0x28dc }
-, { "braille_dots_3458", 0x289c }
-, { "braille_dots_346", 0x282c }
-, { "braille_dots_3467", 0x286c }
-, { "braille_dots_34678", 0x28ec }
-, { "braille_dots_3468", 0x28ac }
-, { "braille_dots_347", 0x284c }
-, { "braille_dots_3478", 0x28cc }
-, { "braille_dots_348", 0x288c }
-, { "braille_dots_35", 0x2814 }
-, { "braille_dots_356", 0x2834 }
-, { "braille_dots_3567", 0x2874 }
-, { "braille_dots_35678", 0x28f4 }
-, { "braille_dots_3568", 0x28b4 }
-, { "braille_dots_357", 0x2854 }
-, { "braille_dots_3578", 0x28d4 }
-, { "braille_dots_358", 0x2894 }
-, { "braille_dots_36", 0x2824 }
-, { "braille_dots_367", 0x2864 }
-, { "braille_dots_3678", 0x28e4 }
-, { "braille_dots_368", 0x28a4 }
-, { "braille_dots_37", 0x2844 }
-, { "braille_dots_378", 0x28c4 }
-, { "braille_dots_38", 0x2884 }
-, { "braille_dots_4", 0x2808 }
-, { "braille_dots_45", 0x2818 }
-, { "braille_dots_456", 0x2838 }
-, { "braille_dots_4567", 0x2878 }
-, { "braille_dots_45678", 0x28f8 }
-, { "braille_dots_4568", 0x28b8 }
-, { "braille_dots_457", 0x2858 }
-, { "braille_dots_4578", 0x28d8 }
-, { "braille_dots_458", 0x2898 }
-, { "braille_dots_46", 0x2828 }
-, { "braille_dots_467", 0x2868 }
-, { "braille_dots_4678", 0x28e8 }
-, { "braille_dots_468", 0x28a8 }
-, { "braille_dots_47", 0x2848 }
-, { "braille_dots_478", 0x28c8 }
-, { "braille_dots_48", 0x2888 }
-, { "braille_dots_5", 0x2810 }
-, { "braille_dots_56", 0x2830 }
-, { "braille_dots_567", 0x2870 }
-, { "braille_dots_5678", 0x28f0 }
-, { "braille_dots_568", 0x28b0 }
-, { "braille_dots_57", 0x2850 }
-, { "braille_dots_578", 0x28d0 }
-, { "braille_dots_58", 0x2890 }
-, { "braille_dots_6", 0x2820 }
-, { "braille_dots_67", 0x2860 }
-, { "braille_dots_678", 0x28e0 }
-, { "braille_dots_68", 0x28a0 }
-, { "braille_dots_7", 0x2840 }
-, { "braille_dots_78", 0x28c0 }
-, { "braille_dots_8", 0x2880 }
-, { "breve", 0x2d8 }
-, { "brokenbar", 0xa6 }
-, { "Byelorussian_shortu", 0x45e }
-, { "Byelorussian_SHORTU", 0x40e }
-};
+// Minimal perfect hash over X11 keysym names. The unseeded hash of a name
+// selects a bucket, whose seed rehashes the name into its unique slot.
+// All tables are constant data: no static constructors or allocations.
+static constexpr auto x11name_num_buckets = uint32_t{436};
+static constexpr auto x11name_num_slots = uint32_t{1744};
 
-static const auto x11nameUtf16Map2 = std::unordered_map<std::string, uint16_t>
-{ { "C", 0x43 }
-, { "c", 0x63 }
-, { "Cabovedot", 0x10a }
-, { "cabovedot", 0x10b }
-, { "Cacute", 0x106 }
-, { "cacute", 0x107 }
-, { "careof", 0x2105 }
-, { "caret", 0x2038 }
-, { "caron", 0x2c7 }
-, { "Ccaron", 0x10c }
-, { "ccaron", 0x10d }
-, { "Ccedilla", 0xc7 }
-, { "ccedilla", 0xe7 }
-, { "Ccircumflex", 0x108 }
-, { "ccircumflex", 0x109 }
-, { "cedilla", 0xb8 }
-, { "cent", 0xa2 }
-, { "checkerboard", 0x2592 }
-, { "checkmark", 0x2713 }
-, { "circle", 0x25cb }
-, { "Clear", 0xb }
-, { "club", 0x2663 }
-, { "colon", 0x3a }
-, { "ColonSign", 0x20a1 }
-, { "combining_acute", 0x301 }
-, { "combining_belowdot", 0x323 }
-, { "combining_grave", 0x300 }
-, { "combining_hook", 0x309 }
-, { "combining_tilde", 0x303 }
-, { "comma", 0x2c }
-, { "containsas", 0x220b }
-, { "copyright", 0xa9 }
-, { "cr", 0x240d }
-, { "crossinglines", 0x253c }
-, { "CruzeiroSign", 0x20a2 }
-, { "cuberoot", 0x221b }
-, { "currency", 0xa4 }
-, { "Cyrillic_a", 0x430 }
-, { "Cyrillic_A", 0x410 }
-, { "Cyrillic_be", 0x431 }
-, { "Cyrillic_BE", 0x411 }
-, { "Cyrillic_che", 0x447 }
-, { "Cyrillic_CHE", 0x427 }
-, { "Cyrillic_CHE_descender", 0x4b6 }
-, { "Cyrillic_che_descender", 0x4b7 }
-, { "Cyrillic_CHE_vertstroke", 0x4b8 }
-, { "Cyrillic_che_vertstroke", 0x4b9 }
-, { "Cyrillic_de", 0x434 }
-, { "Cyrillic_DE", 0x414 }
-, { "Cyrillic_dzhe", 0x45f }
-, { "Cyrillic_DZHE", 0x40f }
-, { "Cyrillic_e", 0x44d }
-, { "Cyrillic_E", 0x42d }
-, { "Cyrillic_ef", 0x444 }
-, { "Cyrillic_EF", 0x424 }
-, { "Cyrillic_el", 0x43b }
-, { "Cyrillic_EL", 0x41b }
-, { "Cyrillic_em", 0x43c }
-, { "Cyrillic_EM", 0x41c }
-, { "Cyrillic_en", 0x43d }
-, { "Cyrillic_EN", 0x41d }
-, { "Cyrillic_EN_descender", 0x4a2 }
-, { "Cyrillic_en_descender", 0x4a3 }
-, { "Cyrillic_er", 0x440 }
-, { "Cyrillic_ER", 0x420 }
-, { "Cyrillic_es", 0x441 }
-, { "Cyrillic_ES", 0x421 }
-, { "Cyrillic_ghe", 0x433 }
-, { "Cyrillic_GHE", 0x413 }
-, { "Cyrillic_GHE_bar", 0x492 }
-, { "Cyrillic_ghe_bar", 0x493 }
-, { "Cyrillic_ha", 0x445 }
-, { "Cyrillic_HA", 0x425 }
-, { "Cyrillic_HA_descender", 0x4b2 }
-, { "Cyrillic_ha_descender", 0x4b3 }
-, { "Cyrillic_hardsign", 0x44a }
-, { "Cyrillic_HARDSIGN", 0x42a }
-, { "Cyrillic_i", 0x438 }
-, { "Cyrillic_I", 0x418 }
-, { "Cyrillic_I_macron", 0x4e2 }
-, { "Cyrillic_i_macron", 0x4e3 }
-, { "Cyrillic_ie", 0x435 }
-, { "Cyrillic_IE", 0x415 }
-, { "Cyrillic_io", 0x451 }
-, { "Cyrillic_IO", 0x401 }
-, { "Cyrillic_je", 0x458 }
-, { "Cyrillic_JE", 0x408 }
-, { "Cyrillic_ka", 0x43a }
-, { "Cyrillic_KA", 0x41a }
-, { "Cyrillic_KA_descender", 0x49a }
-, { "Cyrillic_ka_descender", 0x49b }
-, { "Cyrillic_KA_vertstroke", 0x49c }
-, { "Cyrillic_ka_vertstroke", 0x49d }
-, { "Cyrillic_lje", 0x459 }
-, { "Cyrillic_LJE", 0x409 }
-, { "Cyrillic_nje", 0x45a }
-, { "Cyrillic_NJE", 0x40a }
-, { "Cyrillic_o", 0x43e }
-, { "Cyrillic_O", 0x41e }
-, { "Cyrillic_O_bar", 0x4e8 }
-, { "Cyrillic_o_bar", 0x4e9 }
-, { "Cyrillic_pe", 0x43f }
-, { "Cyrillic_PE", 0x41f }
-, { "Cyrillic_SCHWA", 0x4d8 }
-, { "Cyrillic_schwa", 0x4d9 }
-, { "Cyrillic_sha", 0x448 }
-, { "Cyrillic_SHA", 0x428 }
-, { "Cyrillic_shcha", 0x449 }
-, { "Cyrillic_SHCHA", 0x429 }
-, { "Cyrillic_SHHA", 0x4ba }
-, { "Cyrillic_shha", 0x4bb }
-, { "Cyrillic_shorti", 0x439 }
-, { "Cyrillic_SHORTI", 0x419 }
-, { "Cyrillic_softsign", 0x44c }
-, { "Cyrillic_SOFTSIGN", 0x42c }
-, { "Cyrillic_te", 0x442 }
-, { "Cyrillic_TE", 0x422 }
-, { "Cyrillic_tse", 0x446 }
-, { "Cyrillic_TSE", 0x426 }
-, { "Cyrillic_u", 0x443 }
-, { "Cyrillic_U", 0x423 }
-, { "Cyrillic_U_macron", 0x4ee }
-, { "Cyrillic_u_macron", 0x4ef }
-, { "Cyrillic_U_straight", 0x4ae }
-, { "Cyrillic_u_straight", 0x4af }
-, { "Cyrillic_U_straight_bar", 0x4b0 }
-, { "Cyrillic_u_straight_bar", 0x4b1 }
-, { "Cyrillic_ve", 0x432 }
-, { "Cyrillic_VE", 0x412 }
-, { "Cyrillic_ya", 0x44f }
-, { "Cyrillic_YA", 0x42f }
-, { "Cyrillic_yeru", 0x44b }
-, { "Cyrillic_YERU", 0x42b }
-, { "Cyrillic_yu", 0x44e }
-, { "Cyrillic_YU", 0x42e }
-, { "Cyrillic_ze", 0x437 }
-, { "Cyrillic_ZE", 0x417 }
-, { "Cyrillic_zhe", 0x436 }
-, { "Cyrillic_ZHE", 0x416 }
-, { "Cyrillic_ZHE_descender", 0x496 }
-, { "Cyrillic_zhe_descender", 0x497 }
-, { "D", 0x44 }
-, { "d", 0x64 }
-, { "Dabovedot", 0x1e0a }
-, { "dabovedot", 0x1e0b }
-, { "dagger", 0x2020 }
-, { "Dcaron", 0x10e }
-, { "dcaron", 0x10f }
-, { "decimalpoint", 0x2e }
-, { "degree", 0xb0 }
-, { "Delete", 0x7f }
-, { "diaeresis", 0xa8 }
-, { "diamond", 0x2666 }
-, { "digitspace", 0x2007 }
-, { "dintegral", 0x222c }
-, { "division", 0xf7 }
-, { "dollar", 0x24 }
-, { "DongSign", 0x20ab }
-, { "doubbaselinedot", 0x2025 }
-, { "doubleacute", 0x2dd }
-, { "doubledagger", 0x2021 }
-, { "doublelowquotemark", 0x201e }
-, { "downarrow", 0x2193 }
-, { "downcaret", 0x2228 }
-, { "downshoe", 0x222a }
-, { "downstile", 0x230a }
-, { "downtack", 0x22a4 }
-, { "Dstroke", 0x110 }
-, { "dstroke", 0x111 }
-, { "E", 0x45 }
-, { "e", 0x65 }
-, { "Eabovedot", 0x116 }
-, { "eabovedot", 0x117 }
-, { "Eacute", 0xc9 }
-, { "eacute", 0xe9 }
-, { "Ebelowdot", 0x1eb8 }
-, { "ebelowdot", 0x1eb9 }
-, { "Ecaron", 0x11a }
-, { "ecaron", 0x11b }
-, { "Ecircumflex", 0xca }
-, { "ecircumflex", 0xea }
-, { "Ecircumflexacute", 0x1ebe }
-, { "ecircumflexacute", 0x1ebf }
-, { "Ecircumflexbelowdot", 0x1ec6 }
-, { "ecircumflexbelowdot", 0x1ec7 }
-, { "Ecircumflexgrave", 0x1ec0 }
-, { "ecircumflexgrave", 0x1ec1 }
-, { "Ecircumflexhook", 0x1ec2 }
-, { "ecircumflexhook", 0x1ec3 }
-, { "Ecircumflextilde", 0x1ec4 }
-, { "ecircumflextilde", 0x1ec5 }
-, { "EcuSign", 0x20a0 }
-, { "Ediaeresis", 0xcb }
-, { "ediaeresis", 0xeb }
-, { "Egrave", 0xc8 }
-, { "egrave", 0xe8 }
-, { "Ehook", 0x1eba }
-, { "ehook", 0x1ebb }
-, { "eightsubscript", 0x2088 }
-, { "eightsuperior", 0x2078 }
-, { "elementof", 0x2208 }
-, { "ellipsis", 0x2026 }
-, { "em3space", 0x2004 }
-, { "em4space", 0x2005 }
-, { "Emacron", 0x112 }
-, { "emacron", 0x113 }
-, { "emdash", 0x2014 }
-, { "emfilledcircle", 0x25cf }
-, { "emfilledrect", 0x25ae }
-, { "emopencircle", 0x25cb }
-, { "emopenrectangle", 0x25af }
-, { "emptyset", 0x2205 }
-, { "emspace", 0x2003 }
-, { "endash", 0x2013 }
-, { "enfilledcircbullet", 0x2022 }
-, { "enfilledsqbullet", 0x25aa }
-, { "ENG", 0x14a }
-, { "eng", 0x14b }
-, { "enopencircbullet", 0x25e6 }
-, { "enopensquarebullet", 0x25ab }
-, { "enspace", 0x2002 }
-, { "Eogonek", 0x118 }
-, { "eogonek", 0x119 }
-, { "equal", 0x3d }
-, { "Escape", 0x1b }
-, { "ETH", 0xd0 }
-, { "Eth", 0xd0 }
-, { "eth", 0xf0 }
-, { "Etilde", 0x1ebc }
-, { "etilde", 0x1ebd }
-, { "euro", 0x20ac }
-, { "EuroSign", 0x20ac }
-, { "exclam", 0x21 }
-, { "exclamdown", 0xa1 }
-, { "EZH", 0x1b7 }
-, { "ezh", 0x292 }
-, { "F", 0x46 }
-, { "f", 0x66 }
-, { "Fabovedot", 0x1e1e }
-, { "fabovedot", 0x1e1f }
-, { "Farsi_0", 0x6f0 }
-, { "Farsi_1", 0x6f1 }
-, { "Farsi_2", 0x6f2 }
-, { "Farsi_3", 0x6f3 }
-, { "Farsi_4", 0x6f4 }
-, { "Farsi_5", 0x6f5 }
-, { "Farsi_6", 0x6f6 }
-, { "Farsi_7", 0x6f7 }
-, { "Farsi_8", 0x6f8 }
-, { "Farsi_9", 0x6f9 }
-, { "Farsi_yeh", 0x6cc }
-, { "femalesymbol", 0x2640 }
-, { "ff", 0x240c }
-, { "FFrancSign", 0x20a3 }
-, { "figdash", 0x2012 }
-, { "filledlefttribullet", 0x25c0 }
-, { "filledrectbullet", 0x25ac }
-, { "filledrighttribullet", 0x25b6 }
-, { "filledtribulletdown", 0x25bc }
-, { "filledtribulletup", 0x25b2 }
-, { "fiveeighths", 0x215d }
-, { "fivesixths", 0x215a }
-, { "fivesubscript", 0x2085 }
-, { "fivesuperior", 0x2075 }
-, { "fourfifths", 0x2158 }
-, { "foursubscript", 0x2084 }
-, { "foursuperior", 0x2074 }
-, { "fourthroot", 0x221c }
-, { "function", 0x192 }
-, { "G", 0x47 }
-, { "g", 0x67 }
-, { "Gabovedot", 0x120 }
-, { "gabovedot", 0x121 }
-, { "Gbreve", 0x11e }
-, { "gbreve", 0x11f }
-, { "Gcaron", 0x1e6 }
-, { "gcaron", 0x1e7 }
-, { "Gcedilla", 0x122 }
-, { "gcedilla", 0x123 }
-, { "Gcircumflex", 0x11c }
-, { "gcircumflex", 0x11d }
-, { "Georgian_an", 0x10d0 }
-, { "Georgian_ban", 0x10d1 }
-, { "Georgian_can", 0x10ea }
-, { "Georgian_char", 0x10ed }
-, { "Georgian_chin", 0x10e9 }
-, { "Georgian_cil", 0x10ec }
-, { "Georgian_don", 0x10d3 }
-, { "Georgian_en", 0x10d4 }
-, { "Georgian_fi", 0x10f6 }
-, { "Georgian_gan", 0x10d2 }
-, { "Georgian_ghan", 0x10e6 }
-, { "Georgian_hae", 0x10f0 }
-, { "Georgian_har", 0x10f4 }
-, { "Georgian_he", 0x10f1 }
-, { "Georgian_hie", 0x10f2 }
-, { "Georgian_hoe", 0x10f5 }
-, { "Georgian_in", 0x10d8 }
-, { "Georgian_jhan", 0x10ef }
-, { "Georgian_jil", 0x10eb }
-, { "Georgian_kan", 0x10d9 }
-, { "Georgian_khar", 0x10e5 }
-, { "Georgian_las", 0x10da }
-, { "Georgian_man", 0x10db }
-, { "Georgian_nar", 0x10dc }
-, { "Georgian_on", 0x10dd }
-, { "Georgian_par", 0x10de }
-, { "Georgian_phar", 0x10e4 }
-, { "Georgian_qar", 0x10e7 }
-, { "Georgian_rae", 0x10e0 }
-, { "Georgian_san", 0x10e1 }
-, { "Georgian_shin", 0x10e8 }
-, { "Georgian_tan", 0x10d7 }
-, { "Georgian_tar", 0x10e2 }
-, { "Georgian_un", 0x10e3 }
-, { "Georgian_vin", 0x10d5 }
-, { "Georgian_we", 0x10f3 }
-, { "Georgian_xan", 0x10ee }
-, { "Georgian_zen", 0x10d6 }
-, { "Georgian_zhar", 0x10df }
-, { "grave", 0x60 }
-, { "greater", 0x3e }
-, { "greaterthanequal", 0x2265 }
-, { "Greek_accentdieresis", 0x385 }
-, { "Greek_ALPHA", 0x391 }
-, { "Greek_alpha", 0x3b1 }
-, { "Greek_ALPHAaccent", 0x386 }
-, { "Greek_alphaaccent", 0x3ac }
-, { "Greek_BETA", 0x392 }
-, { "Greek_beta", 0x3b2 }
-, { "Greek_CHI", 0x3a7 }
-, { "Greek_chi", 0x3c7 }
-, { "Greek_DELTA", 0x394 }
-, { "Greek_delta", 0x3b4 }
-, { "Greek_EPSILON", 0x395 }
-, { "Greek_epsilon", 0x3b5 }
-, { "Greek_EPSILONaccent", 0x388 }
-, { "Greek_epsilonaccent", 0x3ad }
-, { "Greek_ETA", 0x397 }
-, { "Greek_eta", 0x3b7 }
-, { "Greek_ETAaccent", 0x389 }
-, { "Greek_etaaccent", 0x3ae }
-, { "Greek_finalsmallsigma", 0x3c2 }
-, { "Greek_GAMMA", 0x393 }
-, { "Greek_gamma", 0x3b3 }
-, { "Greek_horizbar", 0x2015 }
-, { "Greek_IOTA", 0x399 }
-, { "Greek_iota", 0x3b9 }
-, { "Greek_IOTAaccent", 0x38a }
-, { "Greek_iotaaccent", 0x3af }
-, { "Greek_iotaaccentdieresis", 0x390 }
-, { "Greek_IOTAdiaeresis", 0x3aa }
-, { "Greek_IOTAdieresis", 0x3aa }
-, { "Greek_iotadieresis", 0x3ca }
-, { "Greek_KAPPA", 0x39a }
-, { "Greek_kappa", 0x3ba }
-, { "Greek_LAMBDA", 0x39b }
-, { "Greek_lambda", 0x3bb }
-, { "Greek_LAMDA", 0x39b }
-, { "Greek_lamda", 0x3bb }
-, { "Greek_MU", 0x39c }
-, { "Greek_mu", 0x3bc }
-, { "Greek_NU", 0x39d }
-, { "Greek_nu", 0x3bd }
-, { "Greek_OMEGA", 0x3a9 }
-, { "Greek_omega", 0x3c9 }
-, { "Greek_OMEGAaccent", 0x38f }
-, { "Greek_omegaaccent", 0x3ce }
-, { "Greek_OMICRON", 0x39f }
-, { "Greek_omicron", 0x3bf }
-, { "Greek_OMICRONaccent", 0x38c }
-, { "Greek_omicronaccent", 0x3cc }
-, { "Greek_PHI", 0x3a6 }
-, { "Greek_phi", 0x3c6 }
-, { "Greek_PI", 0x3a0 }
-, { "Greek_pi", 0x3c0 }
-, { "Greek_PSI", 0x3a8 }
-, { "Greek_psi", 0x3c8 }
-, { "Greek_RHO", 0x3a1 }
-, { "Greek_rho", 0x3c1 }
-, { "Greek_SIGMA", 0x3a3 }
-, { "Greek_sigma", 0x3c3 }
-, { "Greek_TAU", 0x3a4 }
-, { "Greek_tau", 0x3c4 }
-, { "Greek_THETA", 0x398 }
-, { "Greek_theta", 0x3b8 }
-, { "Greek_UPSILON", 0x3a5 }
-, { "Greek_upsilon", 0x3c5 }
-, { "Greek_UPSILONaccent", 0x38e }
-, { "Greek_upsilonaccent", 0x3cd }
-, { "Greek_upsilonaccentdieresis", 0x3b0 }
-, { "Greek_UPSILONdieresis", 0x3ab }
-, { "Greek_upsilondieresis", 0x3cb }
-, { "Greek_XI", 0x39e }
-, { "Greek_xi", 0x3be }
-, { "Greek_ZETA", 0x396 }
-, { "Greek_zeta", 0x3b6 }
-, { "guillemotleft", 0xab }
-, { "guillemotright", 0xbb }
+static constexpr uint16_t x11name_seeds[] =
+{ 0x0003, 0x0007, 0x00b5, 0x0069, 0x002f, 0x0014, 0x0008, 0x0003
+, 0x0002, 0x0003, 0x0008, 0x005d, 0x0007, 0x0009, 0x001f, 0x0002
+, 0x0061, 0x0019, 0x0001, 0x0062, 0x001d, 0x0013, 0x001e, 0x0003
+, 0x0082, 0x0055, 0x0022, 0x00bf, 0x0001, 0x001a, 0x0004, 0x0051
+, 0x0025, 0x0067, 0x0007, 0x009f, 0x002c, 0x0001, 0x0003, 0x00a8
+, 0x000a, 0x005c, 0x0011, 0x007d, 0x0040, 0x001f, 0x0023, 0x0003
+, 0x0004, 0x0003, 0x00ce, 0x0132, 0x006c, 0x0080, 0x0002, 0x0015
+, 0x003a, 0x0036, 0x0070, 0x0048, 0x001a, 0x0000, 0x0079, 0x000d
+, 0x000f, 0x000a, 0x000e, 0x0000, 0x0027, 0x004d, 0x000a, 0x0000
+, 0x0005, 0x0005, 0x0097, 0x00c2, 0x0070, 0x002b, 0x0008, 0x0177
+, 0x0001, 0x00ca, 0x001a, 0x0042, 0x00ab, 0x001a, 0x000e, 0x0001
+, 0x0002, 0x0002, 0x00b1, 0x00d6, 0x0001, 0x0005, 0x0004, 0x001e
+, 0x0018, 0x00d9, 0x0006, 0x000e, 0x0005, 0x0003, 0x0001, 0x0105
+, 0x001b, 0x0001, 0x000c, 0x0037, 0x0004, 0x0040, 0x0007, 0x0043
+, 0x0000, 0x0037, 0x0004, 0x0007, 0x0001, 0x001c, 0x0009, 0x0207
+, 0x0028, 0x0001, 0x0010, 0x01d2, 0x0062, 0x00a8, 0x001c, 0x0053
+, 0x0003, 0x0005, 0x0009, 0x0018, 0x0001, 0x0007, 0x000a, 0x0012
+, 0x0008, 0x0011, 0x0051, 0x0004, 0x018a, 0x0012, 0x0004, 0x001b
+, 0x0141, 0x001e, 0x0017, 0x0003, 0x002d, 0x000d, 0x002d, 0x011b
+, 0x0011, 0x00a9, 0x0057, 0x0001, 0x0002, 0x004c, 0x005d, 0x0052
+, 0x0001, 0x0006, 0x0009, 0x0025, 0x00a8, 0x0013, 0x0021, 0x005a
+, 0x0004, 0x002c, 0x007e, 0x0020, 0x008a, 0x0327, 0x0002, 0x0003
+, 0x0018, 0x0002, 0x0001, 0x00a5, 0x00f7, 0x00d6, 0x000e, 0x0002
+, 0x0005, 0x001a, 0x00b9, 0x0006, 0x0036, 0x0022, 0x00ec, 0x008e
+, 0x000e, 0x006d, 0x0141, 0x0071, 0x0061, 0x015e, 0x0036, 0x0038
+, 0x0016, 0x0010, 0x0055, 0x004d, 0x0001, 0x0001, 0x0003, 0x001b
+, 0x0001, 0x0048, 0x0001, 0x0001, 0x00dd, 0x0012, 0x002d, 0x006d
+, 0x009f, 0x0007, 0x0001, 0x0001, 0x0106, 0x0091, 0x0010, 0x029f
+, 0x005e, 0x0002, 0x010c, 0x0014, 0x0215, 0x011e, 0x000b, 0x0043
+, 0x00c5, 0x009d, 0x0006, 0x0060, 0x004e, 0x0149, 0x007a, 0x0008
+, 0x0012, 0x0077, 0x066e, 0x0003, 0x002a, 0x00bb, 0x0002, 0x0060
+, 0x0003, 0x0001, 0x0018, 0x02cb, 0x0003, 0x0001, 0x0006, 0x0025
+, 0x000c, 0x0000, 0x0000, 0x016e, 0x0000, 0x0002, 0x0026, 0x0031
+, 0x0038, 0x01b9, 0x016f, 0x029c, 0x0003, 0x0031, 0x00c0, 0x000d
+, 0x0536, 0x0043, 0x005d, 0x02e1, 0x0006, 0x0089, 0x0002, 0x004d
+, 0x00c4, 0x0129, 0x004c, 0x0010, 0x0001, 0x0001, 0x0002, 0x0003
+, 0x0017, 0x0010, 0x0002, 0x00dc, 0x0007, 0x001e, 0x0015, 0x0003
+, 0x0033, 0x0057, 0x01ba, 0x027f, 0x00f9, 0x018b, 0x0005, 0x000d
+, 0x0024, 0x0013, 0x0013, 0x0003, 0x0013, 0x00fc, 0x0021, 0x0000
+, 0x0003, 0x00aa, 0x0022, 0x002e, 0x0008, 0x0068, 0x001b, 0x0098
+, 0x0067, 0x001f, 0x01b9, 0x0010, 0x01a2, 0x000f, 0x0092, 0x0092
+, 0x00d9, 0x0227, 0x02b1, 0x0008, 0x001a, 0x00a3, 0x024a, 0x0003
+, 0x01cd, 0x006d, 0x00bf, 0x004b, 0x0004, 0x01e1, 0x0011, 0x0007
+, 0x0029, 0x03fa, 0x0005, 0x000b, 0x0005, 0x003b, 0x0005, 0x00c0
+, 0x0006, 0x00af, 0x043d, 0x0001, 0x00ac, 0x0734, 0x001f, 0x000b
+, 0x0075, 0x005e, 0x0114, 0x0025, 0x0001, 0x017d, 0x0063, 0x0626
+, 0x002b, 0x0030, 0x00c0, 0x01e4, 0x0003, 0x02e0, 0x061b, 0x0292
+, 0x0053, 0x0cab, 0x0375, 0x0087, 0x00be, 0x01dc, 0x001c, 0x0066
+, 0x009a, 0x0088, 0x0003, 0x0169, 0x025a, 0x0462, 0x0001, 0x01fe
+, 0x000b, 0x0063, 0x023c, 0x0295, 0x01e1, 0x0281, 0x033a, 0x013c
+, 0x00db, 0x02bb, 0x0503, 0x0001, 0x0008, 0x0006, 0x02b3, 0x0005
+, 0x016b, 0x010b, 0x04fd, 0x07e9, 0x0001, 0x0169, 0x0008, 0x01c1
+, 0x0007, 0x006e, 0x0029, 0x00cb, 0x006f, 0x0c7a, 0x027c, 0x0323
+, 0x0429, 0x0447, 0x029f, 0x00fa, 0x0ab5, 0x0025, 0x069c, 0x02cb
+, 0x0467, 0x01aa, 0x0613, 0x0a53
 };
 
-static const auto x11nameUtf16Map3 = std::unordered_map<std::string, uint16_t>
-{ { "H", 0x48 }
-, { "h", 0x68 }
-, { "hairspace", 0x200a }
-, { "Hangul_A", 0x314f }
-, { "Hangul_AE", 0x3150 }
-, { "Hangul_AraeA", 0x318d }
-, { "Hangul_AraeAE", 0x318e }
-, { "Hangul_Cieuc", 0x314a }
-, { "Hangul_Dikeud", 0x3137 }
-, { "Hangul_E", 0x3154 }
-, { "Hangul_EO", 0x3153 }
-, { "Hangul_EU", 0x3161 }
-, { "Hangul_Hieuh", 0x314e }
-, { "Hangul_I", 0x3163 }
-, { "Hangul_Ieung", 0x3147 }
-, { "Hangul_J_Cieuc", 0x11be }
-, { "Hangul_J_Dikeud", 0x11ae }
-, { "Hangul_J_Hieuh", 0x11c2 }
-, { "Hangul_J_Ieung", 0x11bc }
-, { "Hangul_J_Jieuj", 0x11bd }
-, { "Hangul_J_Khieuq", 0x11bf }
-, { "Hangul_J_Kiyeog", 0x11a8 }
-, { "Hangul_J_KiyeogSios", 0x11aa }
-, { "Hangul_J_KkogjiDalrinIeung", 0x11f0 }
-, { "Hangul_J_Mieum", 0x11b7 }
-, { "Hangul_J_Nieun", 0x11ab }
-, { "Hangul_J_NieunHieuh", 0x11ad }
-, { "Hangul_J_NieunJieuj", 0x11ac }
-, { "Hangul_J_PanSios", 0x11eb }
-, { "Hangul_J_Phieuf", 0x11c1 }
-, { "Hangul_J_Pieub", 0x11b8 }
-, { "Hangul_J_PieubSios", 0x11b9 }
-, { "Hangul_J_Rieul", 0x11af }
-, { "Hangul_J_RieulHieuh", 0x11b6 }
-, { "Hangul_J_RieulKiyeog", 0x11b0 }
-, { "Hangul_J_RieulMieum", 0x11b1 }
-, { "Hangul_J_RieulPhieuf", 0x11b5 }
-, { "Hangul_J_RieulPieub", 0x11b2 }
-, { "Hangul_J_RieulSios", 0x11b3 }
-, { "Hangul_J_RieulTieut", 0x11b4 }
-, { "Hangul_J_Sios", 0x11ba }
-, { "Hangul_J_SsangKiyeog", 0x11a9 }
-, { "Hangul_J_SsangSios", 0x11bb }
-, { "Hangul_J_Tieut", 0x11c0 }
-, { "Hangul_J_YeorinHieuh", 0x11f9 }
-, { "Hangul_Jieuj", 0x3148 }
-, { "Hangul_Khieuq", 0x314b }
-, { "Hangul_Kiyeog", 0x3131 }
-, { "Hangul_KiyeogSios", 0x3133 }
-, { "Hangul_KkogjiDalrinIeung", 0x3181 }
-, { "Hangul_Mieum", 0x3141 }
-, { "Hangul_Nieun", 0x3134 }
-, { "Hangul_NieunHieuh", 0x3136 }
-, { "Hangul_NieunJieuj", 0x3135 }
-, { "Hangul_O", 0x3157 }
-, { "Hangul_OE", 0x315a }
-, { "Hangul_PanSios", 0x317f }
-, { "Hangul_Phieuf", 0x314d }
-, { "Hangul_Pieub", 0x3142 }
-, { "Hangul_PieubSios", 0x3144 }
-, { "Hangul_Rieul", 0x3139 }
-, { "Hangul_RieulHieuh", 0x3140 }
-, { "Hangul_RieulKiyeog", 0x313a }
-, { "Hangul_RieulMieum", 0x313b }
-, { "Hangul_RieulPhieuf", 0x313f }
-, { "Hangul_RieulPieub", 0x313c }
-, { "Hangul_RieulSios", 0x313d }
-, { "Hangul_RieulTieut", 0x313e }
-, { "Hangul_RieulYeorinHieuh", 0x316d }
-, { "Hangul_Sios", 0x3145 }
-, { "Hangul_SsangDikeud", 0x3138 }
-, { "Hangul_SsangJieuj", 0x3149 }
-, { "Hangul_SsangKiyeog", 0x3132 }
-, { "Hangul_SsangPieub", 0x3143 }
-, { "Hangul_SsangSios", 0x3146 }
-, { "Hangul_SunkyeongeumMieum", 0x3171 }
-, { "Hangul_SunkyeongeumPhieuf", 0x3184 }
-, { "Hangul_SunkyeongeumPieub", 0x3178 }
-, { "Hangul_Tieut", 0x314c }
-, { "Hangul_U", 0x315c }
-, { "Hangul_WA", 0x3158 }
-, { "Hangul_WAE", 0x3159 }
-, { "Hangul_WE", 0x315e }
-, { "Hangul_WEO", 0x315d }
-, { "Hangul_WI", 0x315f }
-, { "Hangul_YA", 0x3151 }
-, { "Hangul_YAE", 0x3152 }
-, { "Hangul_YE", 0x3156 }
-, { "Hangul_YEO", 0x3155 }
-, { "Hangul_YeorinHieuh", 0x3186 }
-, { "Hangul_YI", 0x3162 }
-, { "Hangul_YO", 0x315b }
-, { "Hangul_YU", 0x3160 }
-, { "Hcircumflex", 0x124 }
-, { "hcircumflex", 0x125 }
-, { "heart", 0x2665 }
-, { "hebrew_aleph", 0x5d0 }
-, { "hebrew_ayin", 0x5e2 }
-, { "hebrew_bet", 0x5d1 }
-, { "hebrew_beth", 0x5d1 }
-, { "hebrew_chet", 0x5d7 }
-, { "hebrew_dalet", 0x5d3 }
-, { "hebrew_daleth", 0x5d3 }
-, { "hebrew_doublelowline", 0x2017 }
-, { "hebrew_finalkaph", 0x5da }
-, { "hebrew_finalmem", 0x5dd }
-, { "hebrew_finalnun", 0x5df }
-, { "hebrew_finalpe", 0x5e3 }
-, { "hebrew_finalzade", 0x5e5 }
-, { "hebrew_finalzadi", 0x5e5 }
-, { "hebrew_gimel", 0x5d2 }
-, { "hebrew_gimmel", 0x5d2 }
-, { "hebrew_he", 0x5d4 }
-, { "hebrew_het", 0x5d7 }
-, { "hebrew_kaph", 0x5db }
-, { "hebrew_kuf", 0x5e7 }
-, { "hebrew_lamed", 0x5dc }
-, { "hebrew_mem", 0x5de }
-, { "hebrew_nun", 0x5e0 }
-, { "hebrew_pe", 0x5e4 }
-, { "hebrew_qoph", 0x5e7 }
-, { "hebrew_resh", 0x5e8 }
-, { "hebrew_samech", 0x5e1 }
-, { "hebrew_samekh", 0x5e1 }
-, { "hebrew_shin", 0x5e9 }
-, { "hebrew_taf", 0x5ea }
-, { "hebrew_taw", 0x5ea }
-, { "hebrew_tet", 0x5d8 }
-, { "hebrew_teth", 0x5d8 }
-, { "hebrew_waw", 0x5d5 }
-, { "hebrew_yod", 0x5d9 }
-, { "hebrew_zade", 0x5e6 }
-, { "hebrew_zadi", 0x5e6 }
-, { "hebrew_zain", 0x5d6 }
-, { "hebrew_zayin", 0x5d6 }
-, { "horizconnector", 0x2500 }
-, { "horizlinescan1", 0x23ba }
-, { "horizlinescan3", 0x23bb }
-, { "horizlinescan5", 0x2500 }
-, { "horizlinescan7", 0x23bc }
-, { "horizlinescan9", 0x23bd }
-, { "Hstroke", 0x126 }
-, { "hstroke", 0x127 }
-, { "ht", 0x2409 }
-, { "hyphen", 0xad }
-, { "I", 0x49 }
-, { "i", 0x69 }
-, { "Iabovedot", 0x130 }
-, { "Iacute", 0xcd }
-, { "iacute", 0xed }
-, { "Ibelowdot", 0x1eca }
-, { "ibelowdot", 0x1ecb }
-, { "Ibreve", 0x12c }
-, { "ibreve", 0x12d }
-, { "Icircumflex", 0xce }
-, { "icircumflex", 0xee }
-, { "identical", 0x2261 }
-, { "Idiaeresis", 0xcf }
-, { "idiaeresis", 0xef }
-, { "idotless", 0x131 }
-, { "ifonlyif", 0x21d4 }
-, { "Igrave", 0xcc }
-, { "igrave", 0xec }
-, { "Ihook", 0x1ec8 }
-, { "ihook", 0x1ec9 }
-, { "Imacron", 0x12a }
-, { "imacron", 0x12b }
-, { "implies", 0x21d2 }
-, { "includedin", 0x2282 }
-, { "includes", 0x2283 }
-, { "infinity", 0x221e }
-, { "integral", 0x222b }
-, { "intersection", 0x2229 }
-, { "Iogonek", 0x12e }
-, { "iogonek", 0x12f }
-, { "Itilde", 0x128 }
-, { "itilde", 0x129 }
-, { "J", 0x4a }
-, { "j", 0x6a }
-, { "Jcircumflex", 0x134 }
-, { "jcircumflex", 0x135 }
-, { "jot", 0x2218 }
-, { "K", 0x4b }
-, { "k", 0x6b }
-, { "kana_a", 0x30a1 }
-, { "kana_A", 0x30a2 }
-, { "kana_CHI", 0x30c1 }
-, { "kana_closingbracket", 0x300d }
-, { "kana_comma", 0x3001 }
-, { "kana_conjunctive", 0x30fb }
-, { "kana_e", 0x30a7 }
-, { "kana_E", 0x30a8 }
-, { "kana_FU", 0x30d5 }
-, { "kana_fullstop", 0x3002 }
-, { "kana_HA", 0x30cf }
-, { "kana_HE", 0x30d8 }
-, { "kana_HI", 0x30d2 }
-, { "kana_HO", 0x30db }
-, { "kana_HU", 0x30d5 }
-, { "kana_i", 0x30a3 }
-, { "kana_I", 0x30a4 }
-, { "kana_KA", 0x30ab }
-, { "kana_KE", 0x30b1 }
-, { "kana_KI", 0x30ad }
-, { "kana_KO", 0x30b3 }
-, { "kana_KU", 0x30af }
-, { "kana_MA", 0x30de }
-, { "kana_ME", 0x30e1 }
-, { "kana_MI", 0x30df }
-, { "kana_middledot", 0x30fb }
-, { "kana_MO", 0x30e2 }
-, { "kana_MU", 0x30e0 }
-, { "kana_N", 0x30f3 }
-, { "kana_NA", 0x30ca }
-, { "kana_NE", 0x30cd }
-, { "kana_NI", 0x30cb }
-, { "kana_NO", 0x30ce }
-, { "kana_NU", 0x30cc }
-, { "kana_o", 0x30a9 }
-, { "kana_O", 0x30aa }
-, { "kana_openingbracket", 0x300c }
-, { "kana_RA", 0x30e9 }
-, { "kana_RE", 0x30ec }
-, { "kana_RI", 0x30ea }
-, { "kana_RO", 0x30ed }
-, { "kana_RU", 0x30eb }
-, { "kana_SA", 0x30b5 }
-, { "kana_SE", 0x30bb }
-, { "kana_SHI", 0x30b7 }
-, { "kana_SO", 0x30bd }
-, { "kana_SU", 0x30b9 }
-, { "kana_TA", 0x30bf }
-, { "kana_TE", 0x30c6 }
-, { "kana_TI", 0x30c1 }
-, { "kana_TO", 0x30c8 }
-, { "kana_tsu", 0x30c3 }
-, { "kana_TSU", 0x30c4 }
-, { "kana_tu", 0x30c3 }
-, { "kana_TU", 0x30c4 }
-, { "kana_u", 0x30a5 }
-, { "kana_U", 0x30a6 }
-, { "kana_WA", 0x30ef }
-, { "kana_WO", 0x30f2 }
-, { "kana_ya", 0x30e3 }
-, { "kana_YA", 0x30e4 }
-, { "kana_yo", 0x30e7 }
-, { "kana_YO", 0x30e8 }
-, { "kana_yu", 0x30e5 }
-, { "kana_YU", 0x30e6 }
-, { "kappa", 0x138 }
-, { "Kcedilla", 0x136 }
-, { "kcedilla", 0x137 }
-, { "Korean_Won", 0x20a9 }
-, { "KP_0", 0x30 }
-, { "KP_1", 0x31 }
-, { "KP_2", 0x32 }
-, { "KP_3", 0x33 }
-, { "KP_4", 0x34 }
-, { "KP_5", 0x35 }
-, { "KP_6", 0x36 }
-, { "KP_7", 0x37 }
-, { "KP_8", 0x38 }
-, { "KP_9", 0x39 }
-, { "KP_Add", 0x2b }
-, { "KP_Decimal", 0x2e }
-, { "KP_Divide", 0x2f }
-, { "KP_Enter", 0xd }
-, { "KP_Equal", 0x3d }
-, { "KP_Multiply", 0x2a }
-, { "KP_Separator", 0x2c }
-, { "KP_Space", 0x20 }
-, { "KP_Subtract", 0x2d }
-, { "KP_Tab", 0x9 }
-, { "kra", 0x138 }
-, { "L", 0x4c }
-, { "l", 0x6c }
-, { "Lacute", 0x139 }
-, { "lacute", 0x13a }
-, { "latincross", 0x271d }
-, { "Lbelowdot", 0x1e36 }
-, { "lbelowdot", 0x1e37 }
-, { "Lcaron", 0x13d }
-, { "lcaron", 0x13e }
-, { "Lcedilla", 0x13b }
-, { "lcedilla", 0x13c }
-, { "leftanglebracket", 0x27e8 }
-, { "leftarrow", 0x2190 }
-, { "leftcaret", 0x3c }
-, { "leftdoublequotemark", 0x201c }
-, { "leftmiddlecurlybrace", 0x23a8 }
-, { "leftopentriangle", 0x25c1 }
-, { "leftpointer", 0x261c }
-, { "leftradical", 0x23b7 }
-, { "leftshoe", 0x2282 }
-, { "leftsinglequotemark", 0x2018 }
-, { "leftt", 0x251c }
-, { "lefttack", 0x22a3 }
-, { "less", 0x3c }
-, { "lessthanequal", 0x2264 }
-, { "lf", 0x240a }
-, { "Linefeed", 0xa }
-, { "LiraSign", 0x20a4 }
-, { "logicaland", 0x2227 }
-, { "logicalor", 0x2228 }
-, { "lowleftcorner", 0x2514 }
-, { "lowrightcorner", 0x2518 }
-, { "Lstroke", 0x141 }
-, { "lstroke", 0x142 }
+static constexpr uint16_t x11name_utf16s[] =
+{ 0x011d, 0x23a4, 0x019f, 0x2282, 0x25ab, 0x1eef, 0x04b9, 0x0654
+, 0x0e1d, 0x0457, 0x00e0, 0x10e9, 0x2613, 0x02d8, 0x00d7, 0x1ede
+, 0x0dc3, 0x11b2, 0x1e8a, 0x3163, 0x222a, 0x039b, 0x043f, 0x02db
+, 0x0106, 0x00b8, 0x00af, 0x064f, 0x2423, 0x04ba, 0x1ec4, 0x2227
+, 0x0033, 0x0111, 0x289c, 0x0178, 0x28de, 0x00f9, 0x04af, 0x30ab
+, 0x044e, 0x0d85, 0x0439, 0x239d, 0x0db1, 0x0655, 0x28a4, 0x054c
+, 0x016d, 0x221b, 0x0536, 0x0628, 0x0388, 0x04b7, 0x1ee4, 0x28a6
+, 0x1ef1, 0x20a9, 0x2813, 0x038e, 0x1ea7, 0x0546, 0x280d, 0x03cd
+, 0x03ba, 0x1ebe, 0x03c9, 0x0698, 0x00e5, 0x004f, 0x0653, 0x30e9
+, 0x0161, 0x3153, 0x2209, 0x064b, 0x006f, 0x0135, 0x30cc, 0x0632
+, 0x0020, 0x25af, 0x0e05, 0x03cc, 0x30e0, 0x00a9, 0x3139, 0x04b2
+, 0x05e7, 0x28d4, 0x10d6, 0x002e, 0x062c, 0x005f, 0x10d4, 0x045c
+, 0x03ae, 0x0040, 0x11ae, 0x00b5, 0x02c7, 0x10d7, 0x28c7, 0x30a9
+, 0x2846, 0x00e9, 0x00ee, 0x2839, 0x2122, 0x2514, 0x3158, 0x0531
+, 0x0152, 0x2320, 0x01a0, 0x0da8, 0x1ec5, 0x00f3, 0x05ea, 0x286f
+, 0x002e, 0x067e, 0x315e, 0x0021, 0x284a, 0x00bd, 0x1ed3, 0x314b
+, 0x0048, 0x1ed2, 0x0e14, 0x2827, 0x0430, 0x2872, 0x11b1, 0x2842
+, 0x0e0f, 0x287e, 0x005d, 0x00a4, 0x0e2b, 0x03bf, 0x045f, 0x215b
+, 0x284c, 0x20a9, 0x0407, 0x1eb7, 0x0159, 0x2829, 0x0d91, 0x0e0c
+, 0x0dd1, 0x20a0, 0x2033, 0x30f2, 0x2814, 0x28dd, 0x040f, 0x00f7
+, 0x10de, 0x1ecf, 0x00ce, 0x2845, 0x28cc, 0x0e1a, 0x00d5, 0x0172
+, 0x05d6, 0x2864, 0x001b, 0x1ea0, 0x05d8, 0x0577, 0x10ed, 0x0670
+, 0x0031, 0x040b, 0x05d5, 0x3161, 0x040a, 0x2860, 0x2889, 0x005f
+, 0x00c2, 0x0142, 0x28c5, 0x286c, 0x300c, 0x0128, 0x28cb, 0x01d1
+, 0x010a, 0x2263, 0x0e03, 0x2892, 0x0446, 0x04e9, 0x283e, 0x0e3e
+, 0x0e4c, 0x3186, 0x2883, 0x0665, 0x2019, 0x0070, 0x016c, 0x0dac
+, 0x2534, 0x0e55, 0x203e, 0x049b, 0x25b7, 0x0030, 0x0144, 0x0125
+, 0x0555, 0x28f7, 0x28bd, 0x01a1, 0x1ee6, 0x1ef6, 0x10d8, 0x0e58
+, 0x2884, 0x280e, 0x0da3, 0x281b, 0x010e, 0x28f4, 0x0041, 0x1e57
+, 0x011a, 0x0039, 0x2190, 0x28b3, 0x0423, 0x03c2, 0x00c1, 0x0db7
+, 0x044a, 0x006d, 0x05d6, 0x0410, 0x0113, 0x056a, 0x1ef0, 0x0103
+, 0x012d, 0x221a, 0x003c, 0x040c, 0x0586, 0x11b9, 0x23a0, 0x03aa
+, 0x0538, 0x2807, 0x0076, 0x10eb, 0x0625, 0x0455, 0x0143, 0x1eaa
+, 0x28fc, 0x2157, 0x2032, 0x1e83, 0x03c7, 0x314e, 0x0413, 0x05e5
+, 0x25cb, 0x0d89, 0x10df, 0x0399, 0x0026, 0x06f8, 0x23b7, 0x1ea4
+, 0x30ce, 0x00c0, 0x0d83, 0x0390, 0x06f6, 0x040a, 0x0049, 0x05dd
+, 0x00da, 0x03c5, 0x00ef, 0x3147, 0x11c2, 0x0169, 0x28b4, 0x03a1
+, 0x0663, 0x2830, 0x2038, 0x0664, 0x0da1, 0x0661, 0x05e9, 0x0119
+, 0x015c, 0x0e4b, 0x30c3, 0x1ea2, 0x0404, 0x25c6, 0x28f8, 0x0691
+, 0x2826, 0x0589, 0x0552, 0x201e, 0x0145, 0x0175, 0x00d8, 0x0009
+, 0x00be, 0x222d, 0x00e6, 0x0e13, 0x0e20, 0x0112, 0x0072, 0x2005
+, 0x0688, 0x0457, 0x061b, 0x041b, 0x0435, 0x1ed7, 0x0075, 0x1ea5
+, 0x00ea, 0x053f, 0x2849, 0x055c, 0x06ba, 0x0275, 0x0e1f, 0x03b2
+, 0x10ec, 0x03c8, 0x0e29, 0x0535, 0x3171, 0x0669, 0x0662, 0x288e
+, 0x0532, 0x0146, 0x057d, 0x30e2, 0x0da6, 0x0dc4, 0x2228, 0x0401
+, 0x0e32, 0x10e1, 0x054e, 0x27e9, 0x0dc2, 0x0634, 0x0dc0, 0x1ed9
+, 0x00fd, 0x315c, 0x251c, 0x0551, 0x28ba, 0x2856, 0x2890, 0x0e57
+, 0x0e11, 0x1e80, 0x0139, 0x0166, 0x042d, 0x25c1, 0x03b8, 0x30bd
+, 0x1e36, 0x04a3, 0x03c1, 0x03ca, 0x25cf, 0x064e, 0x0392, 0x20a8
+, 0x05e4, 0x0416, 0x28f3, 0x0647, 0x0686, 0x0022, 0x0067, 0x2117
+, 0x0e1e, 0x002b, 0x11b4, 0x02d9, 0x00d3, 0x1e02, 0x1eab, 0x0129
+, 0x2717, 0x0e2e, 0x0631, 0x007d, 0x0077, 0x2592, 0x3181, 0x28e4
+, 0x0058, 0x0162, 0x0428, 0x0405, 0x1e37, 0x03cb, 0x007b, 0x2021
+, 0x00ad, 0x2836, 0x0e21, 0x28d1, 0x23bd, 0x0074, 0x288d, 0x2510
+, 0x2817, 0x2007, 0x0418, 0x0071, 0x1ec0, 0x00e1, 0x014d, 0x0d9b
+, 0x055d, 0x2896, 0x0154, 0x06f2, 0x056d, 0x2227, 0x0dd8, 0x282c
+, 0x2804, 0x0e02, 0x0409, 0x2713, 0x280a, 0x28be, 0x313a, 0x04d9
+, 0x221d, 0x0db9, 0x06f3, 0x2518, 0x0e16, 0x11b7, 0x0434, 0x2078
+, 0x2228, 0x28e5, 0x285e, 0x2070, 0x0d88, 0x2208, 0x0120, 0x3131
+, 0x11b0, 0x005e, 0x06f9, 0x00cb, 0x013e, 0x1ea3, 0x015b, 0x0035
+, 0x0412, 0x0e4a, 0x0dbd, 0x011b, 0x1ead, 0x013c, 0x28db, 0x2321
+, 0x30ca, 0x10d5, 0x287f, 0x23bb, 0x039a, 0x0452, 0x0562, 0x10f4
+, 0x239e, 0x28a0, 0x1e60, 0x11bd, 0x00d2, 0x2500, 0x0e41, 0x1ef9
+, 0x313d, 0x05e7, 0x2858, 0x01b6, 0x00ed, 0x2075, 0x10f0, 0x2004
+, 0x0101, 0x28e8, 0x1ef7, 0x2192, 0x0141, 0x28ae, 0x2871, 0x040f
+, 0x03a3, 0x0157, 0x314f, 0x1ec6, 0x1e1f, 0x0daf, 0x0e56, 0x05d2
+, 0x0d9d, 0x318d, 0x0e49, 0x2848, 0x039b, 0x2820, 0x2205, 0x20a7
+, 0x0630, 0x10d3, 0x03a5, 0x30c4, 0x06f5, 0x25b3, 0x01b0, 0x002f
+, 0x1ed0, 0x23a8, 0x005b, 0x2080, 0x0151, 0x0445, 0x0e34, 0x00a0
+, 0x0027, 0x061f, 0x317f, 0x30fb, 0x28f9, 0x0448, 0x0574, 0x0d93
+, 0x0168, 0x0411, 0x0e07, 0x30e1, 0x0156, 0x2805, 0x28a8, 0x006e
+, 0x2861, 0x0458, 0x03b7, 0x04b3, 0x0395, 0x23ba, 0x0e52, 0x2022
+, 0x28dc, 0x0417, 0x2821, 0x0045, 0x28c6, 0x0dda, 0x00a5, 0x1ee8
+, 0x0054, 0x280c, 0x012b, 0x261c, 0x012c, 0x00f0, 0x10ea, 0x10e3
+, 0x313e, 0x281f, 0x058a, 0x2081, 0x0641, 0x0589, 0x28aa, 0x283d
+, 0x002f, 0x0e2c, 0x002b, 0x1e6b, 0x2853, 0x0044, 0x017c, 0x30df
+, 0x28cf, 0x0424, 0x2859, 0x0148, 0x0e27, 0x253c, 0x30d8, 0x28b5
+, 0x0572, 0x011c, 0x1ed4, 0x0da2, 0x0454, 0x045a, 0x11f9, 0x20a2
+, 0x20ac, 0x28a2, 0x0e0e, 0x0444, 0x2873, 0x00b2, 0x0582, 0x03bb
+, 0x11ac, 0x05dc, 0x0e12, 0x27e8, 0x215d, 0x00b1, 0x05d3, 0x0548
+, 0x285c, 0x2809, 0x0db4, 0x28d0, 0x00dc, 0x3151, 0x2500, 0x28d3
+, 0x250c, 0x20a3, 0x28fd, 0x0036, 0x0d87, 0x043a, 0x1eec, 0x0061
+, 0x0637, 0x0137, 0x282d, 0x017d, 0x00a1, 0x0066, 0x06f4, 0x00d0
+, 0x220b, 0x00f8, 0x0447, 0x3184, 0x00fa, 0x1ee2, 0x002a, 0x2837
+, 0x0d94, 0x00c4, 0x28a3, 0x00df, 0x0118, 0x0024, 0x0029, 0x00f2
+, 0x00d1, 0x0dd9, 0x2009, 0x2089, 0x01e7, 0x0454, 0x0563, 0x05e0
+, 0x30a1, 0x23a1, 0x0e10, 0x28e0, 0x285a, 0x1ebd, 0x0449, 0x3150
+, 0x3144, 0x287c, 0x1ee3, 0x25cb, 0x10d9, 0x28b7, 0x0177, 0x2202
+, 0x0d9a, 0x2265, 0x3155, 0x0d8e, 0x0059, 0x04ef, 0x30e8, 0x0422
+, 0x055e, 0x252c, 0x05d0, 0x0570, 0x2308, 0x0565, 0x2229, 0x0134
+, 0x03ad, 0x21d4, 0x300d, 0x06f7, 0x1ed1, 0x2810, 0x0e09, 0x0585
+, 0x1ea8, 0x286b, 0x0496, 0x060c, 0x0549, 0x2153, 0x28c1, 0x00f6
+, 0x01d2, 0x003e, 0x1ee0, 0x0627, 0x28b2, 0x03bb, 0x0104, 0x30c4
+, 0x2283, 0x30e4, 0x00e3, 0x2825, 0x10f3, 0x00f4, 0x30a7, 0x054b
+, 0x0580, 0x011e, 0x015e, 0x30b3, 0x0028, 0x3145, 0x003b, 0x2234
+, 0x1ec7, 0x0623, 0x0165, 0x30e6, 0x28b9, 0x313b, 0x0150, 0x0458
+, 0x2247, 0x007c, 0x041e, 0x11eb, 0x20a1, 0x0192, 0x0425, 0x004c
+, 0x30a2, 0x03b3, 0x03a4, 0x0034, 0x3138, 0x0543, 0x0433, 0x28f1
+, 0x211e, 0x010f, 0x1ec1, 0x2524, 0x0e15, 0x0e25, 0x1eba, 0x28a1
+, 0x0042, 0x2003, 0x016f, 0x042b, 0x0e51, 0x007f, 0x0564, 0x2894
+, 0x0652, 0x2013, 0x00ab, 0x2832, 0x0490, 0x0578, 0x2640, 0x043c
+, 0x0025, 0x0e35, 0x2012, 0x10f1, 0x215a, 0x000a, 0x2264, 0x0155
+, 0x0451, 0x30af, 0x3140, 0x0643, 0x0053, 0x1ee1, 0x00bc, 0x3133
+, 0x260e, 0x0d8b, 0x0164, 0x03af, 0x0147, 0x0107, 0x2084, 0x2424
+, 0x0651, 0x0158, 0x06d4, 0x03a8, 0x000d, 0x0545, 0x056c, 0x056e
+, 0x0569, 0x0300, 0x2002, 0x0e1c, 0x0e24, 0x2898, 0x0020, 0x038a
+, 0x010c, 0x0408, 0x0650, 0x2875, 0x28b8, 0x0138, 0x2083, 0x06cc
+, 0x015a, 0x2026, 0x0629, 0x2874, 0x0541, 0x10e6, 0x2876, 0x006c
+, 0x25ae, 0x282b, 0x054d, 0x0d86, 0x2082, 0x0666, 0x0648, 0x30cd
+, 0x0055, 0x0e46, 0x015f, 0x0046, 0x221c, 0x1ef8, 0x0547, 0x06c1
+, 0x039d, 0x0033, 0x30aa, 0x30d5, 0x00aa, 0x30e5, 0x1ec8, 0x287d
+, 0x0534, 0x2879, 0x00f5, 0x286e, 0x0e06, 0x0626, 0x045e, 0x0624
+, 0x11b8, 0x004e, 0x2018, 0x30e7, 0x28bb, 0x0e47, 0x28d8, 0x2262
+, 0x28a5, 0x0117, 0x0e0a, 0x0584, 0x05e1, 0x2854, 0x0d9e, 0x28bc
+, 0x1eb2, 0x28e6, 0x2015, 0x0127, 0x11b6, 0x28fb, 0x0679, 0x28cd
+, 0x00b7, 0x0109, 0x0533, 0x25c0, 0x2881, 0x002c, 0x30c8, 0x0dcf
+, 0x28ca, 0x0e2f, 0x00f1, 0x30a4, 0x2878, 0x063a, 0x2855, 0x0009
+, 0x2828, 0x1eb0, 0x23a6, 0x0d95, 0x0e37, 0x0116, 0x00bf, 0x30cb
+, 0x28fa, 0x004a, 0x012a, 0x044c, 0x215e, 0x0079, 0x054f, 0x0153
+, 0x0da5, 0x05d3, 0x0056, 0x2863, 0x053c, 0x03a7, 0x0537, 0x002a
+, 0x00cc, 0x03b9, 0x014a, 0x055d, 0x282e, 0x0ddf, 0x0108, 0x2891
+, 0x287a, 0x0497, 0x22a4, 0x1eda, 0x0063, 0x281d, 0x00e4, 0x05e2
+, 0x049a, 0x2835, 0x2851, 0x0e01, 0x05e6, 0x04a2, 0x1ed8, 0x0441
+, 0x039c, 0x2899, 0x0437, 0x282f, 0x2882, 0x062d, 0x25ad, 0x1ef2
+, 0x0419, 0x1eed, 0x011f, 0x30c6, 0x00ae, 0x1e82, 0x28c3, 0x1ebf
+, 0x0dba, 0x2833, 0x2806, 0x20a4, 0x013b, 0x316d, 0x0391, 0x0389
+, 0x20a5, 0x1e1e, 0x0638, 0x1eeb, 0x28a7, 0x042a, 0x03b4, 0x05db
+, 0x28d7, 0x0dc5, 0x0e43, 0x04b8, 0x200a, 0x261e, 0x3132, 0x04ee
+, 0x000d, 0x003d, 0x30c1, 0x0034, 0x0e42, 0x0032, 0x11b3, 0x1eb4
+, 0x2811, 0x2869, 0x00de, 0x0e1b, 0x00a8, 0x0131, 0x05e1, 0x0170
+, 0x0122, 0x30cf, 0x0df4, 0x0052, 0x2808, 0x00b9, 0x0160, 0x30a8
+, 0x0dd0, 0x064a, 0x25bd, 0x1edc, 0x28a9, 0x3001, 0x0db8, 0x240c
+, 0x2261, 0x00b4, 0x03c6, 0x0dab, 0x0436, 0x0105, 0x2824, 0x06af
+, 0x03b5, 0x053a, 0x2844, 0x2877, 0x0110, 0x00b3, 0x00b6, 0x041a
+, 0x044d, 0x002c, 0x03a0, 0x0e38, 0x1eb5, 0x283a, 0x0309, 0x2154
+, 0x10ee, 0x1eaf, 0x1e85, 0x1edb, 0x064c, 0x016e, 0x1edf, 0x03a9
+, 0x10d1, 0x03c0, 0x05e5, 0x0176, 0x05df, 0x280f, 0x283c, 0x057b
+, 0x00cd, 0x28c9, 0x10e5, 0x0642, 0x00e7, 0x0e48, 0x23a3, 0x1e8b
+, 0x23bc, 0x041f, 0x0dd4, 0x00c3, 0x0027, 0x00c5, 0x2843, 0x0173
+, 0x043b, 0x30fb, 0x11bb, 0x3156, 0x10ef, 0x2840, 0x30b9, 0x280b
+, 0x20ab, 0x05da, 0x0dae, 0x1ebb, 0x1e61, 0x281a, 0x04bb, 0x014c
+, 0x053d, 0x043d, 0x28b1, 0x28f5, 0x044b, 0x288c, 0x00c9, 0x284d
+, 0x00b0, 0x288f, 0x2665, 0x28d6, 0x287b, 0x11c0, 0x28ea, 0x00c7
+, 0x0038, 0x0e44, 0x11af, 0x00a7, 0x03ab, 0x06cc, 0x314c, 0x1eee
+, 0x0ddb, 0x2801, 0x2086, 0x00eb, 0x0136, 0x045a, 0x0e18, 0x0443
+, 0x2235, 0x0581, 0x30ec, 0x002d, 0x2857, 0x288a, 0x284f, 0x30ef
+, 0x30d5, 0x0303, 0x2885, 0x0179, 0x223c, 0x221e, 0x0427, 0x0e36
+, 0x0e53, 0x286d, 0x0daa, 0x057e, 0x2819, 0x0573, 0x00d8, 0x062f
+, 0x0da4, 0x1ecc, 0x0062, 0x012e, 0x28e9, 0x06be, 0x055e, 0x1eac
+, 0x0da9, 0x0406, 0x0ddc, 0x266d, 0x0429, 0x016b, 0x28ee, 0x283f
+, 0x10d2, 0x0dbb, 0x28f6, 0x055a, 0x0e2d, 0x2014, 0x0e59, 0x1ec2
+, 0x1ece, 0x0d9c, 0x2862, 0x0dca, 0x3141, 0x0d8c, 0x0259, 0x10dd
+, 0x04b6, 0x0554, 0x1ec9, 0x0540, 0x0421, 0x058a, 0x017e, 0x0e2a
+, 0x30a3, 0x10f6, 0x007a, 0x0da0, 0x2852, 0x056b, 0x000b, 0x04ae
+, 0x00ff, 0x053b, 0x0060, 0x30db, 0x2850, 0x05d7, 0x05e6, 0x22a2
+, 0x062a, 0x0635, 0x0039, 0x2815, 0x0432, 0x0301, 0x0032, 0x003f
+, 0x010d, 0x05d7, 0x05d1, 0x00a2, 0x2812, 0x2606, 0x28f0, 0x0e4d
+, 0x30e3, 0x03c4, 0x1eb9, 0x0579, 0x2017, 0x2085, 0x0035, 0x30a6
+, 0x06f1, 0x0dd3, 0x0db5, 0x039f, 0x2283, 0x012f, 0x005c, 0x28af
+, 0x315a, 0x11ba, 0x05d9, 0x1ee5, 0x10db, 0x1ec3, 0x28ec, 0x00fb
+, 0x314d, 0x03bd, 0x006b, 0x0da7, 0x0e19, 0x2076, 0x3154, 0x03b1
+, 0x20aa, 0x2502, 0x2880, 0x25b2, 0x0583, 0x0553, 0x28e3, 0x0544
+, 0x28fe, 0x0550, 0x2887, 0x00ec, 0x0566, 0x11c1, 0x0102, 0x0649
+, 0x25ac, 0x2260, 0x0dd2, 0x1eae, 0x2315, 0x266f, 0x2663, 0x040e
+, 0x2893, 0x28ff, 0x2282, 0x23ac, 0x0e0b, 0x10e4, 0x2822, 0x28b6
+, 0x0420, 0x1e03, 0x30ea, 0x1ecb, 0x289f, 0x2800, 0x1eca, 0x0d82
+, 0x0df3, 0x11bc, 0x0130, 0x10dc, 0x0138, 0x28e7, 0x240a, 0x10da
+, 0x0057, 0x017a, 0x0e54, 0x0456, 0x01b7, 0x0167, 0x0065, 0x017b
+, 0x2868, 0x0023, 0x3142, 0x2079, 0x28e2, 0x230a, 0x2895, 0x062e
+, 0x0587, 0x0126, 0x318e, 0x2666, 0x0431, 0x0d8d, 0x0575, 0x289a
+, 0x0e3f, 0x30de, 0x1e56, 0x056f, 0x0393, 0x1eb8, 0x315f, 0x0567
+, 0x1e6a, 0x2803, 0x315d, 0x04e2, 0x30fc, 0x221a, 0x03ce, 0x314a
+, 0x04e8, 0x2642, 0x0030, 0x3146, 0x3152, 0x05de, 0x0e33, 0x04d8
+, 0x30c3, 0x22a3, 0x038c, 0x00d4, 0x11ad, 0x281e, 0x10e2, 0x10e8
+, 0x0171, 0x2720, 0x0442, 0x2823, 0x0123, 0x11bf, 0x28bf, 0x30ed
+, 0x06a4, 0x28ab, 0x0491, 0x30ad, 0x1ea6, 0x003a, 0x0404, 0x00de
+, 0x0037, 0x03a6, 0x1ea9, 0x01b5, 0x3135, 0x0385, 0x0561, 0x0037
+, 0x0408, 0x2105, 0x03aa, 0x041c, 0x28f2, 0x2802, 0x240d, 0x04b1
+, 0x10f5, 0x201c, 0x2116, 0x30eb, 0x2229, 0x0174, 0x0e04, 0x2191
+, 0x281c, 0x062b, 0x0100, 0x045b, 0x271d, 0x0031, 0x0636, 0x00af
+, 0x0576, 0x0073, 0x3160, 0x06f0, 0x05d2, 0x0622, 0x30c1, 0x0e50
+, 0x0459, 0x286a, 0x00f8, 0x28c8, 0x0e31, 0x1ef4, 0x0386, 0x30bb
+, 0x309c, 0x003d, 0x0db6, 0x1edd, 0x2816, 0x045f, 0x20a6, 0x3143
+, 0x2030, 0x0e0d, 0x0e26, 0x2074, 0x0dc1, 0x0633, 0x1e0b, 0x2409
+, 0x3136, 0x01e6, 0x0456, 0x2818, 0x28df, 0x11a9, 0x014b, 0x28ef
+, 0x0644, 0x0621, 0x0e08, 0x0407, 0x0038, 0x05e3, 0x0036, 0x00e2
+, 0x042c, 0x0060, 0x0e17, 0x04e3, 0x285f, 0x3137, 0x00d6, 0x055b
+, 0x1ef5, 0x0571, 0x0dd6, 0x2159, 0x1e0a, 0x10d0, 0x288b, 0x309b
+, 0x222b, 0x049d, 0x1e81, 0x2025, 0x013d, 0x28da, 0x3149, 0x044f
+, 0x28d9, 0x0394, 0x30b5, 0x215c, 0x01af, 0x11aa, 0x004d, 0x289d
+, 0x2248, 0x285b, 0x00c6, 0x2841, 0x1ebc, 0x28ed, 0x2865, 0x2218
+, 0x0e45, 0x2008, 0x28c2, 0x066a, 0x0645, 0x239b, 0x3134, 0x05ea
+, 0x1e40, 0x0409, 0x28c0, 0x055c, 0x284e, 0x2202, 0x039e, 0x00ba
+, 0x057c, 0x1eb1, 0x0d96, 0x03ac, 0x03c3, 0x2088, 0x2395, 0x1eea
+, 0x0323, 0x055b, 0x0dc6, 0x2870, 0x2155, 0x1e41, 0x3157, 0x2020
+, 0x30a5, 0x0440, 0x00c8, 0x30bf, 0x00cf, 0x28d2, 0x054a, 0x0415
+, 0x3178, 0x3002, 0x2886, 0x00ca, 0x201d, 0x250c, 0x1eb3, 0x25bc
+, 0x11ab, 0x2077, 0x10e7, 0x0667, 0x005a, 0x02dd, 0x0dde, 0x0e30
+, 0x010b, 0x284b, 0x05e8, 0x2847, 0x30b7, 0x3162, 0x004b, 0x1ed6
+, 0x20ac, 0x2207, 0x00a6, 0x0403, 0x0539, 0x0556, 0x1ef3, 0x28d5
+, 0x064d, 0x006a, 0x28ad, 0x0e40, 0x03bc, 0x3159, 0x00dd, 0x00d0
+, 0x0068, 0x049c, 0x11be, 0x016a, 0x25e6, 0x1ea1, 0x0e28, 0x0043
+, 0x0d9f, 0x00e8, 0x053e, 0x015d, 0x28c4, 0x2838, 0x1eb6, 0x222c
+, 0x007e, 0x0e3a, 0x03b0, 0x0db0, 0x0124, 0x2158, 0x28b0, 0x28e1
+, 0x0414, 0x00fc, 0x0ddd, 0x0008, 0x00bb, 0x289e, 0x038f, 0x289b
+, 0x042f, 0x0064, 0x282a, 0x0e39, 0x1ed5, 0x0568, 0x06a9, 0x00db
+, 0x0660, 0x05d4, 0x002e, 0x03be, 0x11a8, 0x0459, 0x313c, 0x05d8
+, 0x201a, 0x0426, 0x2087, 0x05d1, 0x25aa, 0x2897, 0x0542, 0x30b1
+, 0x1e84, 0x10f2, 0x0492, 0x0163, 0x0398, 0x22a5, 0x042e, 0x2831
+, 0x28eb, 0x0438, 0x11f0, 0x0df2, 0x222a, 0x00fe, 0x0d8a, 0x00a3
+, 0x002d, 0x0d92, 0x0402, 0x30f3, 0x04b0, 0x285d, 0x0e22, 0x2867
+, 0x10e0, 0x0e23, 0x041d, 0x313f, 0x0d90, 0x057f, 0x2866, 0x0397
+, 0x018f, 0x0dad, 0x0493, 0x2243, 0x25b6, 0x3148, 0x0050, 0x0069
+, 0x2888, 0x1ecd, 0x30d2, 0x0668, 0x2502, 0x003e, 0x2193, 0x0121
+, 0x0db3, 0x03b6, 0x0396, 0x0647, 0x003c, 0x0640, 0x28ce, 0x0639
+, 0x1ee7, 0x0047, 0x0646, 0x00ac, 0x283b, 0x0078, 0x315b, 0x0051
+, 0x0292, 0x043e, 0x2156, 0x28ac, 0x21d2, 0x057a, 0x240b, 0x0453
+, 0x0406, 0x11b5, 0x1ee9, 0x0d8f, 0x2834, 0x013a, 0x06d2, 0x00d9
 };
 
-static const auto x11nameUtf16Map4 = std::unordered_map<std::string, uint16_t>
-{ { "M", 0x4d }
-, { "m", 0x6d }
-, { "Mabovedot", 0x1e40 }
-, { "mabovedot", 0x1e41 }
-, { "Macedonia_dse", 0x455 }
-, { "Macedonia_DSE", 0x405 }
-, { "Macedonia_gje", 0x453 }
-, { "Macedonia_GJE", 0x403 }
-, { "Macedonia_kje", 0x45c }
-, { "Macedonia_KJE", 0x40c }
-, { "macron", 0xaf }
-, { "malesymbol", 0x2642 }
-, { "maltesecross", 0x2720 }
-, { "masculine", 0xba }
-, { "MillSign", 0x20a5 }
-, { "minus", 0x2d }
-, { "minutes", 0x2032 }
-, { "mu", 0xb5 }
-, { "multiply", 0xd7 }
-, { "musicalflat", 0x266d }
-, { "musicalsharp", 0x266f }
-, { "N", 0x4e }
-, { "n", 0x6e }
-, { "nabla", 0x2207 }
-, { "Nacute", 0x143 }
-, { "nacute", 0x144 }
-, { "NairaSign", 0x20a6 }
-, { "Ncaron", 0x147 }
-, { "ncaron", 0x148 }
-, { "Ncedilla", 0x145 }
-, { "ncedilla", 0x146 }
-, { "NewSheqelSign", 0x20aa }
-, { "ninesubscript", 0x2089 }
-, { "ninesuperior", 0x2079 }
-, { "nl", 0x2424 }
-, { "nobreakspace", 0xa0 }
-, { "notapproxeq", 0x2247 }
-, { "notelementof", 0x2209 }
-, { "notequal", 0x2260 }
-, { "notidentical", 0x2262 }
-, { "notsign", 0xac }
-, { "Ntilde", 0xd1 }
-, { "ntilde", 0xf1 }
-, { "numbersign", 0x23 }
-, { "numerosign", 0x2116 }
-, { "O", 0x4f }
-, { "o", 0x6f }
-, { "Oacute", 0xd3 }
-, { "oacute", 0xf3 }
-, { "Obarred", 0x19f }
-, { "obarred", 0x275 }
-, { "Obelowdot", 0x1ecc }
-, { "obelowdot", 0x1ecd }
-, { "Ocaron", 0x1d1 }
-, { "ocaron", 0x1d2 }
-, { "Ocircumflex", 0xd4 }
-, { "ocircumflex", 0xf4 }
-, { "Ocircumflexacute", 0x1ed0 }
-, { "ocircumflexacute", 0x1ed1 }
-, { "Ocircumflexbelowdot", 0x1ed8 }
-, { "ocircumflexbelowdot", 0x1ed9 }
-, { "Ocircumflexgrave", 0x1ed2 }
-, { "ocircumflexgrave", 0x1ed3 }
-, { "Ocircumflexhook", 0x1ed4 }
-, { "ocircumflexhook", 0x1ed5 }
-, { "Ocircumflextilde", 0x1ed6 }
-, { "ocircumflextilde", 0x1ed7 }
-, { "Odiaeresis", 0xd6 }
-, { "odiaeresis", 0xf6 }
-, { "Odoubleacute", 0x150 }
-, { "odoubleacute", 0x151 }
-, { "OE", 0x152 }
-, { "oe", 0x153 }
-, { "ogonek", 0x2db }
-, { "Ograve", 0xd2 }
-, { "ograve", 0xf2 }
-, { "Ohook", 0x1ece }
-, { "ohook", 0x1ecf }
-, { "Ohorn", 0x1a0 }
-, { "ohorn", 0x1a1 }
-, { "Ohornacute", 0x1eda }
-, { "ohornacute", 0x1edb }
-, { "Ohornbelowdot", 0x1ee2 }
-, { "ohornbelowdot", 0x1ee3 }
-, { "Ohorngrave", 0x1edc }
-, { "ohorngrave", 0x1edd }
-, { "Ohornhook", 0x1ede }
-, { "ohornhook", 0x1edf }
-, { "Ohorntilde", 0x1ee0 }
-, { "ohorntilde", 0x1ee1 }
-, { "Omacron", 0x14c }
-, { "omacron", 0x14d }
-, { "oneeighth", 0x215b }
-, { "onefifth", 0x2155 }
-, { "onehalf", 0xbd }
-, { "onequarter", 0xbc }
-, { "onesixth", 0x2159 }
-, { "onesubscript", 0x2081 }
-, { "onesuperior", 0xb9 }
-, { "onethird", 0x2153 }
-, { "Ooblique", 0xd8 }
-, { "ooblique", 0xf8 }
-, { "openrectbullet", 0x25ad }
-, { "openstar", 0x2606 }
-, { "opentribulletdown", 0x25bd }
-, { "opentribulletup", 0x25b3 }
-, { "ordfeminine", 0xaa }
-, { "Oslash", 0xd8 }
-, { "oslash", 0xf8 }
-, { "Otilde", 0xd5 }
-, { "otilde", 0xf5 }
-, { "overbar", 0xaf }
-, { "overline", 0x203e }
-, { "P", 0x50 }
-, { "p", 0x70 }
-, { "Pabovedot", 0x1e56 }
-, { "pabovedot", 0x1e57 }
-, { "paragraph", 0xb6 }
-, { "parenleft", 0x28 }
-, { "parenright", 0x29 }
-, { "partdifferential", 0x2202 }
-, { "partialderivative", 0x2202 }
-, { "percent", 0x25 }
-, { "period", 0x2e }
-, { "periodcentered", 0xb7 }
-, { "permille", 0x2030 }
-, { "PesetaSign", 0x20a7 }
-, { "phonographcopyright", 0x2117 }
-, { "plus", 0x2b }
-, { "plusminus", 0xb1 }
-, { "prescription", 0x211e }
-, { "prolongedsound", 0x30fc }
-, { "punctspace", 0x2008 }
-, { "Q", 0x51 }
-, { "q", 0x71 }
-, { "quad", 0x2395 }
-, { "question", 0x3f }
-, { "questiondown", 0xbf }
-, { "quotedbl", 0x22 }
-, { "quoteleft", 0x60 }
-, { "quoteright", 0x27 }
-, { "R", 0x52 }
-, { "r", 0x72 }
-, { "Racute", 0x154 }
-, { "racute", 0x155 }
-, { "radical", 0x221a }
-, { "Rcaron", 0x158 }
-, { "rcaron", 0x159 }
-, { "Rcedilla", 0x156 }
-, { "rcedilla", 0x157 }
-, { "registered", 0xae }
-, { "Return", 0xd }
-, { "rightanglebracket", 0x27e9 }
-, { "rightarrow", 0x2192 }
-, { "rightcaret", 0x3e }
-, { "rightdoublequotemark", 0x201d }
-, { "rightmiddlecurlybrace", 0x23ac }
-, { "rightopentriangle", 0x25b7 }
-, { "rightpointer", 0x261e }
-, { "rightshoe", 0x2283 }
-, { "rightsinglequotemark", 0x2019 }
-, { "rightt", 0x2524 }
-, { "righttack", 0x22a2 }
-, { "RupeeSign", 0x20a8 }
-, { "S", 0x53 }
-, { "s", 0x73 }
-, { "Sabovedot", 0x1e60 }
-, { "sabovedot", 0x1e61 }
-, { "Sacute", 0x15a }
-, { "sacute", 0x15b }
-, { "Scaron", 0x160 }
-, { "scaron", 0x161 }
-, { "Scedilla", 0x15e }
-, { "scedilla", 0x15f }
-, { "SCHWA", 0x18f }
-, { "schwa", 0x259 }
-, { "Scircumflex", 0x15c }
-, { "scircumflex", 0x15d }
-, { "seconds", 0x2033 }
-, { "section", 0xa7 }
-, { "semicolon", 0x3b }
-, { "semivoicedsound", 0x309c }
-, { "Serbian_dje", 0x452 }
-, { "Serbian_DJE", 0x402 }
-, { "Serbian_dze", 0x45f }
-, { "Serbian_DZE", 0x40f }
-, { "Serbian_je", 0x458 }
-, { "Serbian_JE", 0x408 }
-, { "Serbian_lje", 0x459 }
-, { "Serbian_LJE", 0x409 }
-, { "Serbian_nje", 0x45a }
-, { "Serbian_NJE", 0x40a }
-, { "Serbian_tshe", 0x45b }
-, { "Serbian_TSHE", 0x40b }
-, { "seveneighths", 0x215e }
-, { "sevensubscript", 0x2087 }
-, { "sevensuperior", 0x2077 }
-, { "signaturemark", 0x2613 }
-, { "signifblank", 0x2423 }
-, { "similarequal", 0x2243 }
-, { "singlelowquotemark", 0x201a }
-, { "Sinh_a", 0xd85 }
-, { "Sinh_aa", 0xd86 }
-, { "Sinh_aa2", 0xdcf }
-, { "Sinh_ae", 0xd87 }
-, { "Sinh_ae2", 0xdd0 }
-, { "Sinh_aee", 0xd88 }
-, { "Sinh_aee2", 0xdd1 }
-, { "Sinh_ai", 0xd93 }
-, { "Sinh_ai2", 0xddb }
-, { "Sinh_al", 0xdca }
-, { "Sinh_au", 0xd96 }
-, { "Sinh_au2", 0xdde }
-, { "Sinh_ba", 0xdb6 }
-, { "Sinh_bha", 0xdb7 }
-, { "Sinh_ca", 0xda0 }
-, { "Sinh_cha", 0xda1 }
-, { "Sinh_dda", 0xda9 }
-, { "Sinh_ddha", 0xdaa }
-, { "Sinh_dha", 0xdaf }
-, { "Sinh_dhha", 0xdb0 }
-, { "Sinh_e", 0xd91 }
-, { "Sinh_e2", 0xdd9 }
-, { "Sinh_ee", 0xd92 }
-, { "Sinh_ee2", 0xdda }
-, { "Sinh_fa", 0xdc6 }
-, { "Sinh_ga", 0xd9c }
-, { "Sinh_gha", 0xd9d }
-, { "Sinh_h2", 0xd83 }
-, { "Sinh_ha", 0xdc4 }
-, { "Sinh_i", 0xd89 }
-, { "Sinh_i2", 0xdd2 }
-, { "Sinh_ii", 0xd8a }
-, { "Sinh_ii2", 0xdd3 }
-, { "Sinh_ja", 0xda2 }
-, { "Sinh_jha", 0xda3 }
-, { "Sinh_jnya", 0xda5 }
-, { "Sinh_ka", 0xd9a }
-, { "Sinh_kha", 0xd9b }
-, { "Sinh_kunddaliya", 0xdf4 }
-, { "Sinh_la", 0xdbd }
-, { "Sinh_lla", 0xdc5 }
-, { "Sinh_lu", 0xd8f }
-, { "Sinh_lu2", 0xddf }
-, { "Sinh_luu", 0xd90 }
-, { "Sinh_luu2", 0xdf3 }
-, { "Sinh_ma", 0xdb8 }
-, { "Sinh_mba", 0xdb9 }
-, { "Sinh_na", 0xdb1 }
-, { "Sinh_ndda", 0xdac }
-, { "Sinh_ndha", 0xdb3 }
-, { "Sinh_ng", 0xd82 }
-, { "Sinh_ng2", 0xd9e }
-, { "Sinh_nga", 0xd9f }
-, { "Sinh_nja", 0xda6 }
-, { "Sinh_nna", 0xdab }
-, { "Sinh_nya", 0xda4 }
-, { "Sinh_o", 0xd94 }
-, { "Sinh_o2", 0xddc }
-, { "Sinh_oo", 0xd95 }
-, { "Sinh_oo2", 0xddd }
-, { "Sinh_pa", 0xdb4 }
-, { "Sinh_pha", 0xdb5 }
-, { "Sinh_ra", 0xdbb }
-, { "Sinh_ri", 0xd8d }
-, { "Sinh_rii", 0xd8e }
-, { "Sinh_ru2", 0xdd8 }
-, { "Sinh_ruu2", 0xdf2 }
-, { "Sinh_sa", 0xdc3 }
-, { "Sinh_sha", 0xdc1 }
-, { "Sinh_ssha", 0xdc2 }
-, { "Sinh_tha", 0xdad }
-, { "Sinh_thha", 0xdae }
-, { "Sinh_tta", 0xda7 }
-, { "Sinh_ttha", 0xda8 }
-, { "Sinh_u", 0xd8b }
-, { "Sinh_u2", 0xdd4 }
-, { "Sinh_uu", 0xd8c }
-, { "Sinh_uu2", 0xdd6 }
-, { "Sinh_va", 0xdc0 }
-, { "Sinh_ya", 0xdba }
-, { "sixsubscript", 0x2086 }
-, { "sixsuperior", 0x2076 }
-, { "slash", 0x2f }
-, { "soliddiamond", 0x25c6 }
-, { "space", 0x20 }
-, { "squareroot", 0x221a }
-, { "ssharp", 0xdf }
-, { "sterling", 0xa3 }
-, { "stricteq", 0x2263 }
+static constexpr uint16_t x11name_offsets[] =
+{ 0, 12, 30, 38, 47, 66, 77, 101
+, 120, 130, 143, 150, 164, 178, 184, 193
+, 203, 211, 231, 241, 250, 256, 269, 281
+, 288, 295, 303, 311, 324, 336, 350, 367
+, 375, 377, 385, 403, 414, 434, 441, 461
+, 469, 481, 488, 504, 518, 526, 545, 562
+, 574, 581, 590, 602, 613, 633, 656, 666
+, 684, 698, 709, 726, 746, 763, 775, 792
+, 812, 824, 841, 853, 864, 870, 872, 891
+, 899, 906, 916, 929, 945, 947, 959, 967
+, 979, 985, 1001, 1014, 1034, 1042, 1052, 1065
+, 1087, 1098, 1116, 1129, 1142, 1154, 1163, 1175
+, 1189, 1205, 1208, 1224, 1227, 1233, 1246, 1265
+, 1272, 1289, 1296, 1308, 1326, 1336, 1350, 1360
+, 1373, 1376, 1388, 1394, 1404, 1421, 1428, 1439
+, 1459, 1466, 1477, 1487, 1494, 1511, 1519, 1536
+, 1550, 1552, 1569, 1580, 1598, 1609, 1627, 1647
+, 1663, 1676, 1696, 1709, 1718, 1729, 1743, 1755
+, 1765, 1782, 1790, 1802, 1817, 1824, 1841, 1848
+, 1861, 1871, 1879, 1887, 1895, 1911, 1931, 1943
+, 1952, 1965, 1971, 1983, 2000, 2018, 2032, 2039
+, 2047, 2059, 2076, 2083, 2093, 2104, 2117, 2131
+, 2155, 2160, 2173, 2184, 2194, 2207, 2223, 2240
+, 2251, 2263, 2271, 2289, 2307, 2327, 2334, 2353
+, 2360, 2370, 2379, 2393, 2410, 2423, 2438, 2457
+, 2480, 2497, 2516, 2533, 2542, 2563, 2565, 2572
+, 2582, 2587, 2598, 2607, 2629, 2647, 2652, 2659
+, 2671, 2682, 2703, 2723, 2729, 2735, 2741, 2753
+, 2766, 2782, 2799, 2808, 2826, 2833, 2852, 2854
+, 2864, 2871, 2876, 2886, 2905, 2916, 2938, 2945
+, 2954, 2972, 2974, 2987, 2998, 3006, 3019, 3033
+, 3040, 3047, 3055, 3060, 3074, 3086, 3105, 3120
+, 3140, 3152, 3169, 3171, 3184, 3206, 3220, 3227
+, 3244, 3264, 3276, 3284, 3291, 3301, 3314, 3327
+, 3344, 3351, 3358, 3372, 3383, 3393, 3401, 3413
+, 3430, 3438, 3445, 3453, 3478, 3486, 3498, 3500
+, 3516, 3523, 3537, 3548, 3561, 3576, 3583, 3601
+, 3611, 3620, 3636, 3642, 3651, 3660, 3669, 3681
+, 3689, 3701, 3718, 3727, 3733, 3746, 3759, 3778
+, 3790, 3807, 3825, 3839, 3858, 3867, 3879, 3888
+, 3895, 3909, 3919, 3922, 3933, 3949, 3957, 3959
+, 3968, 3980, 3992, 4009, 4021, 4033, 4050, 4052
+, 4069, 4081, 4094, 4111, 4127, 4146, 4154, 4165
+, 4176, 4189, 4199, 4211, 4225, 4250, 4259, 4268
+, 4286, 4299, 4308, 4320, 4328, 4337, 4345, 4355
+, 4367, 4379, 4392, 4405, 4423, 4433, 4446, 4454
+, 4474, 4481, 4490, 4496, 4509, 4528, 4546, 4562
+, 4575, 4594, 4601, 4608, 4615, 4626, 4643, 4655
+, 4663, 4673, 4695, 4705, 4724, 4739, 4752, 4763
+, 4773, 4783, 4796, 4816, 4827, 4840, 4849, 4851
+, 4871, 4884, 4889, 4909, 4918, 4925, 4935, 4952
+, 4959, 4971, 4985, 4995, 5006, 5008, 5021, 5046
+, 5064, 5066, 5075, 5088, 5102, 5112, 5134, 5144
+, 5157, 5164, 5182, 5192, 5210, 5225, 5227, 5245
+, 5259, 5277, 5288, 5299, 5301, 5318, 5325, 5333
+, 5342, 5355, 5373, 5380, 5388, 5401, 5412, 5421
+, 5438, 5453, 5466, 5478, 5488, 5504, 5524, 5543
+, 5558, 5568, 5577, 5585, 5600, 5614, 5629, 5641
+, 5655, 5665, 5684, 5703, 5716, 5725, 5735, 5745
+, 5759, 5780, 5792, 5800, 5811, 5818, 5824, 5831
+, 5833, 5845, 5857, 5865, 5872, 5892, 5901, 5921
+, 5933, 5941, 5954, 5975, 5990, 6002, 6014, 6027
+, 6040, 6055, 6071, 6081, 6096, 6103, 6118, 6130
+, 6137, 6154, 6166, 6183, 6191, 6198, 6211, 6224
+, 6233, 6241, 6259, 6265, 6276, 6284, 6303, 6321
+, 6335, 6347, 6356, 6365, 6385, 6395, 6404, 6416
+, 6430, 6439, 6452, 6464, 6480, 6492, 6507, 6516
+, 6527, 6539, 6552, 6566, 6574, 6582, 6598, 6604
+, 6610, 6627, 6648, 6660, 6674, 6687, 6699, 6710
+, 6723, 6734, 6755, 6770, 6785, 6805, 6818, 6831
+, 6839, 6846, 6858, 6870, 6878, 6887, 6903, 6920
+, 6922, 6939, 6951, 6961, 6983, 6997, 7012, 7025
+, 7044, 7063, 7075, 7091, 7093, 7111, 7120, 7124
+, 7135, 7137, 7153, 7161, 7173, 7180, 7184, 7197
+, 7209, 7227, 7246, 7264, 7277, 7288, 7307, 7325
+, 7344, 7354, 7367, 7374, 7384, 7402, 7404, 7414
+, 7422, 7442, 7454, 7472, 7479, 7491, 7505, 7513
+, 7532, 7546, 7558, 7574, 7582, 7594, 7607, 7628
+, 7641, 7646, 7663, 7676, 7688, 7707, 7719, 7733
+, 7745, 7765, 7778, 7794, 7811, 7823, 7833, 7846
+, 7858, 7876, 7892, 7900, 7917, 7928, 7938, 7953
+, 7972, 7987, 7998, 8019, 8024, 8032, 8044, 8054
+, 8056, 8067, 8076, 8094, 8101, 8112, 8114, 8122
+, 8126, 8137, 8146, 8159, 8185, 8192, 8206, 8215
+, 8234, 8241, 8252, 8270, 8277, 8285, 8292, 8303
+, 8310, 8317, 8325, 8335, 8349, 8356, 8369, 8382
+, 8393, 8400, 8417, 8430, 8447, 8465, 8472, 8487
+, 8497, 8514, 8533, 8547, 8560, 8573, 8593, 8605
+, 8623, 8631, 8648, 8659, 8668, 8670, 8688, 8696
+, 8708, 8724, 8729, 8742, 8754, 8762, 8776, 8783
+, 8795, 8815, 8824, 8844, 8852, 8869, 8884, 8898
+, 8909, 8925, 8944, 8967, 8980, 8993, 9002, 9019
+, 9030, 9037, 9045, 9056, 9068, 9086, 9099, 9107
+, 9116, 9125, 9133, 9140, 9157, 9169, 9181, 9188
+, 9200, 9212, 9219, 9228, 9236, 9246, 9258, 9268
+, 9278, 9298, 9317, 9324, 9332, 9351, 9369, 9382
+, 9393, 9405, 9409, 9420, 9437, 9447, 9456, 9468
+, 9470, 9477, 9489, 9499, 9501, 9520, 9534, 9547
+, 9566, 9579, 9586, 9603, 9610, 9621, 9633, 9639
+, 9656, 9658, 9666, 9672, 9686, 9699, 9706, 9718
+, 9735, 9748, 9755, 9769, 9786, 9812, 9824, 9837
+, 9849, 9857, 9869, 9877, 9889, 9900, 9909, 9923
+, 9930, 9942, 9950, 9968, 9979, 9981, 9992, 10003
+, 10021, 10031, 10038, 10045, 10062, 10069, 10076, 10090
+, 10093, 10107, 10114, 10130, 10140, 10149, 10161, 10175
+, 10188, 10200, 10216, 10224, 10238, 10246, 10263, 10272
+, 10289, 10296, 10307, 10320, 10339, 10357, 10363, 10378
+, 10388, 10395, 10404, 10422, 10440, 10453, 10467, 10486
+, 10488, 10501, 10519, 10531, 10539, 10552, 10561, 10572
+, 10580, 10582, 10596, 10605, 10607, 10618, 10625, 10638
+, 10654, 10663, 10668, 10675, 10683, 10695, 10703, 10709
+, 10729, 10741, 10760, 10767, 10786, 10802, 10820, 10840
+, 10858, 10873, 10875, 10895, 10903, 10923, 10938, 10956
+, 10969, 10987, 10997, 11011, 11023, 11037, 11054, 11063
+, 11082, 11093, 11112, 11127, 11135, 11155, 11176, 11188
+, 11207, 11222, 11234, 11247, 11267, 11283, 11296, 11304
+, 11313, 11331, 11346, 11353, 11360, 11378, 11391, 11409
+, 11413, 11429, 11441, 11459, 11467, 11480, 11490, 11503
+, 11511, 11531, 11533, 11541, 11559, 11572, 11574, 11588
+, 11591, 11601, 11615, 11617, 11635, 11649, 11659, 11670
+, 11682, 11689, 11700, 11704, 11729, 11747, 11756, 11768
+, 11785, 11804, 11827, 11836, 11847, 11849, 11867, 11878
+, 11890, 11912, 11930, 11947, 11958, 11970, 11992, 12012
+, 12024, 12033, 12051, 12063, 12082, 12098, 12109, 12124
+, 12131, 12147, 12157, 12164, 12172, 12183, 12190, 12208
+, 12225, 12233, 12251, 12267, 12276, 12285, 12309, 12321
+, 12337, 12346, 12356, 12367, 12378, 12397, 12415, 12427
+, 12439, 12459, 12468, 12487, 12511, 12521, 12534, 12553
+, 12571, 12578, 12587, 12596, 12601, 12612, 12617, 12636
+, 12648, 12664, 12682, 12688, 12699, 12709, 12718, 12732
+, 12745, 12754, 12762, 12778, 12780, 12795, 12807, 12814
+, 12821, 12830, 12841, 12859, 12870, 12888, 12899, 12907
+, 12910, 12920, 12926, 12936, 12945, 12958, 12966, 12982
+, 12993, 13007, 13020, 13036, 13056, 13064, 13078, 13088
+, 13100, 13111, 13117, 13126, 13137, 13149, 13167, 13182
+, 13192, 13205, 13217, 13228, 13239, 13255, 13261, 13271
+, 13283, 13296, 13305, 13322, 13334, 13350, 13368, 13386
+, 13398, 13405, 13423, 13437, 13448, 13457, 13468, 13485
+, 13495, 13510, 13522, 13530, 13537, 13548, 13554, 13571
+, 13579, 13591, 13608, 13627, 13637, 13651, 13666, 13674
+, 13691, 13700, 13717, 13727, 13733, 13743, 13760, 13774
+, 13782, 13795, 13807, 13825, 13845, 13859, 13876, 13883
+, 13901, 13908, 13927, 13933, 13952, 13972, 13987, 14006
+, 14015, 14017, 14037, 14052, 14060, 14082, 14099, 14112
+, 14123, 14132, 14147, 14160, 14171, 14180, 14192, 14206
+, 14217, 14225, 14238, 14246, 14252, 14271, 14288, 14307
+, 14315, 14323, 14339, 14356, 14363, 14375, 14384, 14397
+, 14409, 14421, 14440, 14450, 14463, 14480, 14494, 14501
+, 14512, 14521, 14531, 14533, 14541, 14560, 14583, 14601
+, 14621, 14630, 14642, 14650, 14662, 14677, 14685, 14705
+, 14725, 14738, 14746, 14766, 14786, 14796, 14803, 14815
+, 14831, 14837, 14845, 14862, 14870, 14883, 14891, 14897
+, 14909, 14932, 14944, 14950, 14962, 14974, 14990, 14997
+, 15008, 15015, 15027, 15029, 15037, 15054, 15067, 15073
+, 15093, 15104, 15117, 15123, 15131, 15147, 15158, 15170
+, 15180, 15191, 15202, 15204, 15221, 15233, 15249, 15251
+, 15260, 15267, 15279, 15291, 15296, 15312, 15321, 15339
+, 15353, 15361, 15371, 15381, 15394, 15415, 15429, 15434
+, 15441, 15449, 15458, 15467, 15481, 15491, 15499, 15509
+, 15529, 15539, 15553, 15564, 15574, 15587, 15603, 15622
+, 15634, 15648, 15657, 15659, 15668, 15678, 15690, 15699
+, 15711, 15725, 15739, 15754, 15772, 15786, 15800, 15819
+, 15832, 15853, 15865, 15883, 15890, 15902, 15918, 15925
+, 15944, 15961, 15970, 15978, 15990, 16008, 16021, 16026
+, 16046, 16064, 16086, 16097, 16119, 16129, 16143, 16159
+, 16178, 16190, 16200, 16208, 16218, 16238, 16252, 16262
+, 16270, 16280, 16295, 16305, 16318, 16322, 16342, 16345
+, 16358, 16360, 16367, 16378, 16389, 16393, 16400, 16402
+, 16412, 16429, 16440, 16453, 16466, 16484, 16494, 16512
+, 16524, 16545, 16553, 16567, 16575, 16587, 16595, 16607
+, 16625, 16635, 16643, 16653, 16666, 16678, 16688, 16698
+, 16709, 16719, 16735, 16746, 16764, 16779, 16790, 16808
+, 16821, 16836, 16847, 16849, 16866, 16877, 16888, 16900
+, 16915, 16923, 16932, 16952, 16964, 16984, 17002, 17015
+, 17029, 17042, 17055, 17067, 17084, 17093, 17109, 17130
+, 17138, 17149, 17168, 17194, 17202, 17219, 17225, 17237
+, 17243, 17248, 17258, 17274, 17282, 17300, 17321, 17334
+, 17336, 17348, 17355, 17374, 17386, 17405, 17420, 17423
+, 17447, 17460, 17480, 17491, 17499, 17512, 17524, 17538
+, 17546, 17563, 17575, 17583, 17596, 17607, 17609, 17620
+, 17627, 17639, 17641, 17651, 17659, 17672, 17691, 17699
+, 17711, 17724, 17742, 17749, 17766, 17782, 17792, 17810
+, 17818, 17834, 17840, 17848, 17859, 17876, 17890, 17900
+, 17918, 17927, 17939, 17947, 17960, 17969, 17981, 17991
+, 17994, 18012, 18019, 18031, 18047, 18068, 18089, 18093
+, 18114, 18125, 18138, 18151, 18164, 18169, 18184, 18186
+, 18198, 18216, 18226, 18241, 18259, 18279, 18293, 18304
+, 18320, 18330, 18343, 18352, 18361, 18371, 18383, 18401
+, 18413, 18422, 18445, 18452, 18468, 18475, 18494, 18512
+, 18524, 18543, 18555, 18563, 18576, 18582, 18602, 18604
+, 18623, 18632, 18651, 18654, 18670, 18677, 18697, 18715
+, 18719, 18736, 18747, 18764, 18779, 18791, 18805, 18818
+, 18829, 18839, 18852, 18868, 18884, 18902, 18919, 18928
+, 18938, 18950, 18962, 18970, 18988, 19000, 19015, 19020
+, 19031, 19050, 19066, 19074, 19091, 19100, 19110, 19119
+, 19126, 19133, 19145, 19152, 19160, 19171, 19189, 19201
+, 19213, 19238, 19252, 19269, 19281, 19302, 19315, 19326
+, 19346, 19361, 19375, 19388, 19397, 19399, 19411, 19420
+, 19431, 19441, 19459, 19471, 19489, 19498, 19508, 19510
+, 19527, 19536, 19542, 19552, 19566, 19578, 19590, 19597
+, 19616, 19632, 19634, 19653, 19664, 19673, 19684, 19691
+, 19695, 19697, 19720, 19735, 19743, 19760, 19770, 19782
+, 19784, 19793, 19800, 19813, 19825, 19842, 19859, 19874
+, 19884, 19895, 19908, 19936, 19946, 19958, 19969, 19986
+, 20004, 20016, 20027, 20036, 20046, 20061, 20080, 20098
+, 20117, 20129, 20131, 20148, 20160, 20176, 20188, 20201
+, 20213, 20222, 20232, 20243, 20252, 20268, 20280, 20298
+, 20310, 20329, 20342, 20357, 20368, 20385, 20404, 20418
+, 20426, 20437, 20450, 20467, 20476, 20488, 20495, 20507
+, 20524, 20544, 20555, 20582, 20592, 20601, 20607, 20615
+, 20624, 20636, 20644, 20656, 20663, 20687, 20706, 20717
+, 20736, 20749, 20760, 20772, 20791, 20800, 20814, 20832
+, 20842, 20848, 20857, 20874, 20887, 20908, 20921, 20923
+, 20925, 20941, 20951, 20959, 20968, 20976, 20987, 20997
+, 21007, 21017, 21028, 21039, 21049, 21059, 21074, 21093
+, 21104, 21110, 21112, 21124, 21132, 21151, 21153, 21163
+, 21165, 21169, 21180, 21190, 21208, 21216, 21228, 21231
+, 21245, 21256, 21277, 21288, 21296, 21313, 21320, 21337
+, 21344
 };
 
-static const auto x11nameUtf16Map5 = std::unordered_map<std::string, uint16_t>
-{ { "T", 0x54 }
-, { "t", 0x74 }
-, { "Tab", 0x9 }
-, { "Tabovedot", 0x1e6a }
-, { "tabovedot", 0x1e6b }
-, { "Tcaron", 0x164 }
-, { "tcaron", 0x165 }
-, { "Tcedilla", 0x162 }
-, { "tcedilla", 0x163 }
-, { "telephone", 0x260e }
-, { "telephonerecorder", 0x2315 }
-, { "Thai_baht", 0xe3f }
-, { "Thai_bobaimai", 0xe1a }
-, { "Thai_chochan", 0xe08 }
-, { "Thai_chochang", 0xe0a }
-, { "Thai_choching", 0xe09 }
-, { "Thai_chochoe", 0xe0c }
-, { "Thai_dochada", 0xe0e }
-, { "Thai_dodek", 0xe14 }
-, { "Thai_fofa", 0xe1d }
-, { "Thai_fofan", 0xe1f }
-, { "Thai_hohip", 0xe2b }
-, { "Thai_honokhuk", 0xe2e }
-, { "Thai_khokhai", 0xe02 }
-, { "Thai_khokhon", 0xe05 }
-, { "Thai_khokhuat", 0xe03 }
-, { "Thai_khokhwai", 0xe04 }
-, { "Thai_khorakhang", 0xe06 }
-, { "Thai_kokai", 0xe01 }
-, { "Thai_lakkhangyao", 0xe45 }
-, { "Thai_lekchet", 0xe57 }
-, { "Thai_lekha", 0xe55 }
-, { "Thai_lekhok", 0xe56 }
-, { "Thai_lekkao", 0xe59 }
-, { "Thai_leknung", 0xe51 }
-, { "Thai_lekpaet", 0xe58 }
-, { "Thai_leksam", 0xe53 }
-, { "Thai_leksi", 0xe54 }
-, { "Thai_leksong", 0xe52 }
-, { "Thai_leksun", 0xe50 }
-, { "Thai_lochula", 0xe2c }
-, { "Thai_loling", 0xe25 }
-, { "Thai_lu", 0xe26 }
-, { "Thai_maichattawa", 0xe4b }
-, { "Thai_maiek", 0xe48 }
-, { "Thai_maihanakat", 0xe31 }
-, { "Thai_maihanakat_maitho", 0xe3e }
-, { "Thai_maitaikhu", 0xe47 }
-, { "Thai_maitho", 0xe49 }
-, { "Thai_maitri", 0xe4a }
-, { "Thai_maiyamok", 0xe46 }
-, { "Thai_moma", 0xe21 }
-, { "Thai_ngongu", 0xe07 }
-, { "Thai_nikhahit", 0xe4d }
-, { "Thai_nonen", 0xe13 }
-, { "Thai_nonu", 0xe19 }
-, { "Thai_oang", 0xe2d }
-, { "Thai_paiyannoi", 0xe2f }
-, { "Thai_phinthu", 0xe3a }
-, { "Thai_phophan", 0xe1e }
-, { "Thai_phophung", 0xe1c }
-, { "Thai_phosamphao", 0xe20 }
-, { "Thai_popla", 0xe1b }
-, { "Thai_rorua", 0xe23 }
-, { "Thai_ru", 0xe24 }
-, { "Thai_saraa", 0xe30 }
-, { "Thai_saraaa", 0xe32 }
-, { "Thai_saraae", 0xe41 }
-, { "Thai_saraaimaimalai", 0xe44 }
-, { "Thai_saraaimaimuan", 0xe43 }
-, { "Thai_saraam", 0xe33 }
-, { "Thai_sarae", 0xe40 }
-, { "Thai_sarai", 0xe34 }
-, { "Thai_saraii", 0xe35 }
-, { "Thai_sarao", 0xe42 }
-, { "Thai_sarau", 0xe38 }
-, { "Thai_saraue", 0xe36 }
-, { "Thai_sarauee", 0xe37 }
-, { "Thai_sarauu", 0xe39 }
-, { "Thai_sorusi", 0xe29 }
-, { "Thai_sosala", 0xe28 }
-, { "Thai_soso", 0xe0b }
-, { "Thai_sosua", 0xe2a }
-, { "Thai_thanthakhat", 0xe4c }
-, { "Thai_thonangmontho", 0xe11 }
-, { "Thai_thophuthao", 0xe12 }
-, { "Thai_thothahan", 0xe17 }
-, { "Thai_thothan", 0xe10 }
-, { "Thai_thothong", 0xe18 }
-, { "Thai_thothung", 0xe16 }
-, { "Thai_topatak", 0xe0f }
-, { "Thai_totao", 0xe15 }
-, { "Thai_wowaen", 0xe27 }
-, { "Thai_yoyak", 0xe22 }
-, { "Thai_yoying", 0xe0d }
-, { "therefore", 0x2234 }
-, { "thinspace", 0x2009 }
-, { "THORN", 0xde }
-, { "Thorn", 0xde }
-, { "thorn", 0xfe }
-, { "threeeighths", 0x215c }
-, { "threefifths", 0x2157 }
-, { "threequarters", 0xbe }
-, { "threesubscript", 0x2083 }
-, { "threesuperior", 0xb3 }
-, { "tintegral", 0x222d }
-, { "topintegral", 0x2320 }
-, { "topleftparens", 0x239b }
-, { "topleftradical", 0x250c }
-, { "topleftsqbracket", 0x23a1 }
-, { "toprightparens", 0x239e }
-, { "toprightsqbracket", 0x23a4 }
-, { "topt", 0x252c }
-, { "trademark", 0x2122 }
-, { "Tslash", 0x166 }
-, { "tslash", 0x167 }
-, { "twofifths", 0x2156 }
-, { "twosubscript", 0x2082 }
-, { "twosuperior", 0xb2 }
-, { "twothirds", 0x2154 }
-, { "U", 0x55 }
-, { "u", 0x75 }
-, { "Uacute", 0xda }
-, { "uacute", 0xfa }
-, { "Ubelowdot", 0x1ee4 }
-, { "ubelowdot", 0x1ee5 }
-, { "Ubreve", 0x16c }
-, { "ubreve", 0x16d }
-, { "Ucircumflex", 0xdb }
-, { "ucircumflex", 0xfb }
-, { "Udiaeresis", 0xdc }
-, { "udiaeresis", 0xfc }
-, { "Udoubleacute", 0x170 }
-, { "udoubleacute", 0x171 }
-, { "Ugrave", 0xd9 }
-, { "ugrave", 0xf9 }
-, { "Uhook", 0x1ee6 }
-, { "uhook", 0x1ee7 }
-, { "Uhorn", 0x1af }
-, { "uhorn", 0x1b0 }
-, { "Uhornacute", 0x1ee8 }
-, { "uhornacute", 0x1ee9 }
-, { "Uhornbelowdot", 0x1ef0 }
-, { "uhornbelowdot", 0x1ef1 }
-, { "Uhorngrave", 0x1eea }
-, { "uhorngrave", 0x1eeb }
-, { "Uhornhook", 0x1eec }
-, { "uhornhook", 0x1eed }
-, { "Uhorntilde", 0x1eee }
-, { "uhorntilde", 0x1eef }
-, { "Ukrainian_ghe_with_upturn", 0x491 }
-, { "Ukrainian_GHE_WITH_UPTURN", 0x490 }
-, { "Ukrainian_i", 0x456 }
-, { "Ukrainian_I", 0x406 }
-, { "Ukrainian_ie", 0x454 }
-, { "Ukrainian_IE", 0x404 }
-, { "Ukrainian_yi", 0x457 }
-, { "Ukrainian_YI", 0x407 }
-, { "Ukranian_i", 0x456 }
-, { "Ukranian_I", 0x406 }
-, { "Ukranian_je", 0x454 }
-, { "Ukranian_JE", 0x404 }
-, { "Ukranian_yi", 0x457 }
-, { "Ukranian_YI", 0x407 }
-, { "Umacron", 0x16a }
-, { "umacron", 0x16b }
-, { "underbar", 0x5f }
-, { "underscore", 0x5f }
-, { "union", 0x222a }
-, { "Uogonek", 0x172 }
-, { "uogonek", 0x173 }
-, { "uparrow", 0x2191 }
-, { "upcaret", 0x2227 }
-, { "upleftcorner", 0x250c }
-, { "uprightcorner", 0x2510 }
-, { "upshoe", 0x2229 }
-, { "upstile", 0x2308 }
-, { "uptack", 0x22a5 }
-, { "Uring", 0x16e }
-, { "uring", 0x16f }
-, { "Utilde", 0x168 }
-, { "utilde", 0x169 }
-, { "V", 0x56 }
-, { "v", 0x76 }
-, { "variation", 0x221d }
-, { "vertbar", 0x2502 }
-, { "vertconnector", 0x2502 }
-, { "voicedsound", 0x309b }
-, { "vt", 0x240b }
-, { "W", 0x57 }
-, { "w", 0x77 }
-, { "Wacute", 0x1e82 }
-, { "wacute", 0x1e83 }
-, { "Wcircumflex", 0x174 }
-, { "wcircumflex", 0x175 }
-, { "Wdiaeresis", 0x1e84 }
-, { "wdiaeresis", 0x1e85 }
-, { "Wgrave", 0x1e80 }
-, { "wgrave", 0x1e81 }
-, { "WonSign", 0x20a9 }
-, { "X", 0x58 }
-, { "x", 0x78 }
-, { "Xabovedot", 0x1e8a }
-, { "xabovedot", 0x1e8b }
-, { "Y", 0x59 }
-, { "y", 0x79 }
-, { "Yacute", 0xdd }
-, { "yacute", 0xfd }
-, { "Ybelowdot", 0x1ef4 }
-, { "ybelowdot", 0x1ef5 }
-, { "Ycircumflex", 0x176 }
-, { "ycircumflex", 0x177 }
-, { "ydiaeresis", 0xff }
-, { "Ydiaeresis", 0x178 }
-, { "yen", 0xa5 }
-, { "Ygrave", 0x1ef2 }
-, { "ygrave", 0x1ef3 }
-, { "Yhook", 0x1ef6 }
-, { "yhook", 0x1ef7 }
-, { "Ytilde", 0x1ef8 }
-, { "ytilde", 0x1ef9 }
-, { "Z", 0x5a }
-, { "z", 0x7a }
-, { "Zabovedot", 0x17b }
-, { "zabovedot", 0x17c }
-, { "Zacute", 0x179 }
-, { "zacute", 0x17a }
-, { "Zcaron", 0x17d }
-, { "zcaron", 0x17e }
-, { "zerosubscript", 0x2080 }
-, { "zerosuperior", 0x2070 }
-, { "Zstroke", 0x1b5 }
-, { "zstroke", 0x1b6 }
-};
+static constexpr char x11name_pool[] =
+	"gcircumflex\0"
+	"toprightsqbracket\0"
+	"Obarred\0"
+	"leftshoe\0"
+	"enopensquarebullet\0"
+	"uhorntilde\0"
+	"Cyrillic_che_vertstroke\0"
+	"Arabic_hamza_above\0"
+	"Thai_fofa\0"
+	"Ukrainian_yi\0"
+	"agrave\0"
+	"Georgian_chin\0"
+	"signaturemark\0"
+	"breve\0"
+	"multiply\0"
+	"Ohornhook\0"
+	"Sinh_sa\0"
+	"Hangul_J_RieulPieub\0"
+	"Xabovedot\0"
+	"Hangul_I\0"
+	"union\0"
+	"Greek_LAMBDA\0"
+	"Cyrillic_pe\0"
+	"ogonek\0"
+	"Cacute\0"
+	"cedilla\0"
+	"overbar\0"
+	"Arabic_damma\0"
+	"signifblank\0"
+	"Cyrillic_SHHA\0"
+	"Ecircumflextilde\0"
+	"upcaret\0"
+	"3\0"
+	"dstroke\0"
+	"braille_dots_3458\0"
+	"Ydiaeresis\0"
+	"braille_dots_234578\0"
+	"ugrave\0"
+	"Cyrillic_u_straight\0"
+	"kana_KA\0"
+	"Cyrillic_yu\0"
+	"Sinh_a\0"
+	"Cyrillic_shorti\0"
+	"botleftparens\0"
+	"Sinh_na\0"
+	"Arabic_hamza_below\0"
+	"braille_dots_368\0"
+	"Armenian_RA\0"
+	"ubreve\0"
+	"cuberoot\0"
+	"Armenian_ZA\0"
+	"Arabic_beh\0"
+	"Greek_EPSILONaccent\0"
+	"Cyrillic_che_descender\0"
+	"Ubelowdot\0"
+	"braille_dots_2368\0"
+	"uhornbelowdot\0"
+	"Korean_Won\0"
+	"braille_dots_125\0"
+	"Greek_UPSILONaccent\0"
+	"acircumflexgrave\0"
+	"Armenian_NU\0"
+	"braille_dots_134\0"
+	"Greek_upsilonaccent\0"
+	"Greek_kappa\0"
+	"Ecircumflexacute\0"
+	"Greek_omega\0"
+	"Arabic_jeh\0"
+	"aring\0"
+	"O\0"
+	"Arabic_madda_above\0"
+	"kana_RA\0"
+	"scaron\0"
+	"Hangul_EO\0"
+	"notelementof\0"
+	"Arabic_fathatan\0"
+	"o\0"
+	"jcircumflex\0"
+	"kana_NU\0"
+	"Arabic_zain\0"
+	"space\0"
+	"emopenrectangle\0"
+	"Thai_khokhon\0"
+	"Greek_omicronaccent\0"
+	"kana_MU\0"
+	"copyright\0"
+	"Hangul_Rieul\0"
+	"Cyrillic_HA_descender\0"
+	"hebrew_kuf\0"
+	"braille_dots_3578\0"
+	"Georgian_zen\0"
+	"decimalpoint\0"
+	"Arabic_jeem\0"
+	"underbar\0"
+	"Georgian_en\0"
+	"Macedonia_kje\0"
+	"Greek_etaaccent\0"
+	"at\0"
+	"Hangul_J_Dikeud\0"
+	"mu\0"
+	"caron\0"
+	"Georgian_tan\0"
+	"braille_dots_12378\0"
+	"kana_o\0"
+	"braille_dots_237\0"
+	"eacute\0"
+	"icircumflex\0"
+	"braille_dots_1456\0"
+	"trademark\0"
+	"lowleftcorner\0"
+	"Hangul_WA\0"
+	"Armenian_AYB\0"
+	"OE\0"
+	"topintegral\0"
+	"Ohorn\0"
+	"Sinh_ttha\0"
+	"ecircumflextilde\0"
+	"oacute\0"
+	"hebrew_taf\0"
+	"braille_dots_123467\0"
+	"period\0"
+	"Arabic_peh\0"
+	"Hangul_WE\0"
+	"exclam\0"
+	"braille_dots_247\0"
+	"onehalf\0"
+	"ocircumflexgrave\0"
+	"Hangul_Khieuq\0"
+	"H\0"
+	"Ocircumflexgrave\0"
+	"Thai_dodek\0"
+	"braille_dots_1236\0"
+	"Cyrillic_a\0"
+	"braille_dots_2567\0"
+	"Hangul_J_RieulMieum\0"
+	"braille_dots_27\0"
+	"Thai_topatak\0"
+	"braille_dots_234567\0"
+	"bracketright\0"
+	"currency\0"
+	"Thai_hohip\0"
+	"Greek_omicron\0"
+	"Serbian_dze\0"
+	"oneeighth\0"
+	"braille_dots_347\0"
+	"WonSign\0"
+	"Ukranian_YI\0"
+	"abrevebelowdot\0"
+	"rcaron\0"
+	"braille_dots_146\0"
+	"Sinh_e\0"
+	"Thai_chochoe\0"
+	"Sinh_aee2\0"
+	"EcuSign\0"
+	"seconds\0"
+	"kana_WO\0"
+	"braille_dots_35\0"
+	"braille_dots_134578\0"
+	"Serbian_DZE\0"
+	"division\0"
+	"Georgian_par\0"
+	"ohook\0"
+	"Icircumflex\0"
+	"braille_dots_137\0"
+	"braille_dots_3478\0"
+	"Thai_bobaimai\0"
+	"Otilde\0"
+	"Uogonek\0"
+	"hebrew_zain\0"
+	"braille_dots_367\0"
+	"Escape\0"
+	"Abelowdot\0"
+	"hebrew_tet\0"
+	"Armenian_sha\0"
+	"Georgian_char\0"
+	"Arabic_superscript_alef\0"
+	"KP_1\0"
+	"Serbian_TSHE\0"
+	"hebrew_waw\0"
+	"Hangul_EU\0"
+	"Cyrillic_NJE\0"
+	"braille_dots_67\0"
+	"braille_dots_148\0"
+	"underscore\0"
+	"Acircumflex\0"
+	"lstroke\0"
+	"braille_dots_1378\0"
+	"braille_dots_3467\0"
+	"kana_openingbracket\0"
+	"Itilde\0"
+	"braille_dots_12478\0"
+	"Ocaron\0"
+	"Cabovedot\0"
+	"stricteq\0"
+	"Thai_khokhuat\0"
+	"braille_dots_258\0"
+	"Cyrillic_tse\0"
+	"Cyrillic_o_bar\0"
+	"braille_dots_23456\0"
+	"Thai_maihanakat_maitho\0"
+	"Thai_thanthakhat\0"
+	"Hangul_YeorinHieuh\0"
+	"braille_dots_128\0"
+	"Arabic_5\0"
+	"rightsinglequotemark\0"
+	"p\0"
+	"Ubreve\0"
+	"Sinh_ndda\0"
+	"bott\0"
+	"Thai_lekha\0"
+	"overline\0"
+	"Cyrillic_ka_descender\0"
+	"rightopentriangle\0"
+	"KP_0\0"
+	"nacute\0"
+	"hcircumflex\0"
+	"Armenian_O\0"
+	"braille_dots_1235678\0"
+	"braille_dots_134568\0"
+	"ohorn\0"
+	"Uhook\0"
+	"Yhook\0"
+	"Georgian_in\0"
+	"Thai_lekpaet\0"
+	"braille_dots_38\0"
+	"braille_dots_234\0"
+	"Sinh_jha\0"
+	"braille_dots_1245\0"
+	"Dcaron\0"
+	"braille_dots_35678\0"
+	"A\0"
+	"pabovedot\0"
+	"Ecaron\0"
+	"KP_9\0"
+	"leftarrow\0"
+	"braille_dots_12568\0"
+	"Cyrillic_U\0"
+	"Greek_finalsmallsigma\0"
+	"Aacute\0"
+	"Sinh_bha\0"
+	"Cyrillic_hardsign\0"
+	"m\0"
+	"hebrew_zayin\0"
+	"Cyrillic_A\0"
+	"emacron\0"
+	"Armenian_zhe\0"
+	"Uhornbelowdot\0"
+	"abreve\0"
+	"ibreve\0"
+	"radical\0"
+	"less\0"
+	"Macedonia_KJE\0"
+	"Armenian_fe\0"
+	"Hangul_J_PieubSios\0"
+	"botrightparens\0"
+	"Greek_IOTAdiaeresis\0"
+	"Armenian_AT\0"
+	"braille_dots_123\0"
+	"v\0"
+	"Georgian_jil\0"
+	"Arabic_hamzaunderalef\0"
+	"Macedonia_dse\0"
+	"Nacute\0"
+	"Acircumflextilde\0"
+	"braille_dots_345678\0"
+	"threefifths\0"
+	"minutes\0"
+	"wacute\0"
+	"Greek_chi\0"
+	"Hangul_Hieuh\0"
+	"Cyrillic_GHE\0"
+	"hebrew_finalzadi\0"
+	"circle\0"
+	"Sinh_i\0"
+	"Georgian_zhar\0"
+	"Greek_IOTA\0"
+	"ampersand\0"
+	"Farsi_8\0"
+	"leftradical\0"
+	"Acircumflexacute\0"
+	"kana_NO\0"
+	"Agrave\0"
+	"Sinh_h2\0"
+	"Greek_iotaaccentdieresis\0"
+	"Farsi_6\0"
+	"Serbian_NJE\0"
+	"I\0"
+	"hebrew_finalmem\0"
+	"Uacute\0"
+	"Greek_upsilon\0"
+	"idiaeresis\0"
+	"Hangul_Ieung\0"
+	"Hangul_J_Hieuh\0"
+	"utilde\0"
+	"braille_dots_3568\0"
+	"Greek_RHO\0"
+	"Arabic_3\0"
+	"braille_dots_56\0"
+	"caret\0"
+	"Arabic_4\0"
+	"Sinh_cha\0"
+	"Arabic_1\0"
+	"hebrew_shin\0"
+	"eogonek\0"
+	"Scircumflex\0"
+	"Thai_maichattawa\0"
+	"kana_tsu\0"
+	"Ahook\0"
+	"Ukrainian_IE\0"
+	"soliddiamond\0"
+	"braille_dots_45678\0"
+	"Arabic_rreh\0"
+	"braille_dots_236\0"
+	"Armenian_verjaket\0"
+	"Armenian_VYUN\0"
+	"doublelowquotemark\0"
+	"Ncedilla\0"
+	"wcircumflex\0"
+	"Ooblique\0"
+	"KP_Tab\0"
+	"threequarters\0"
+	"tintegral\0"
+	"ae\0"
+	"Thai_nonen\0"
+	"Thai_phosamphao\0"
+	"Emacron\0"
+	"r\0"
+	"em4space\0"
+	"Arabic_ddal\0"
+	"Ukranian_yi\0"
+	"Arabic_semicolon\0"
+	"Cyrillic_EL\0"
+	"Cyrillic_ie\0"
+	"ocircumflextilde\0"
+	"u\0"
+	"acircumflexacute\0"
+	"ecircumflex\0"
+	"Armenian_KEN\0"
+	"braille_dots_147\0"
+	"Armenian_amanak\0"
+	"Arabic_noon_ghunna\0"
+	"obarred\0"
+	"Thai_fofan\0"
+	"Greek_beta\0"
+	"Georgian_cil\0"
+	"Greek_psi\0"
+	"Thai_sorusi\0"
+	"Armenian_YECH\0"
+	"Hangul_SunkyeongeumMieum\0"
+	"Arabic_9\0"
+	"Arabic_2\0"
+	"braille_dots_2348\0"
+	"Armenian_BEN\0"
+	"ncedilla\0"
+	"Armenian_se\0"
+	"kana_MO\0"
+	"Sinh_nja\0"
+	"Sinh_ha\0"
+	"downcaret\0"
+	"Cyrillic_IO\0"
+	"Thai_saraaa\0"
+	"Georgian_san\0"
+	"Armenian_VEV\0"
+	"rightanglebracket\0"
+	"Sinh_ssha\0"
+	"Arabic_sheen\0"
+	"Sinh_va\0"
+	"ocircumflexbelowdot\0"
+	"yacute\0"
+	"Hangul_U\0"
+	"leftt\0"
+	"Armenian_TSO\0"
+	"braille_dots_24568\0"
+	"braille_dots_2357\0"
+	"braille_dots_58\0"
+	"Thai_lekchet\0"
+	"Thai_thonangmontho\0"
+	"Wgrave\0"
+	"Lacute\0"
+	"Tslash\0"
+	"Cyrillic_E\0"
+	"leftopentriangle\0"
+	"Greek_theta\0"
+	"kana_SO\0"
+	"Lbelowdot\0"
+	"Cyrillic_en_descender\0"
+	"Greek_rho\0"
+	"Greek_iotadieresis\0"
+	"emfilledcircle\0"
+	"Arabic_fatha\0"
+	"Greek_BETA\0"
+	"RupeeSign\0"
+	"hebrew_pe\0"
+	"Cyrillic_ZHE\0"
+	"braille_dots_125678\0"
+	"Arabic_heh\0"
+	"Arabic_tcheh\0"
+	"quotedbl\0"
+	"g\0"
+	"phonographcopyright\0"
+	"Thai_phophan\0"
+	"plus\0"
+	"Hangul_J_RieulTieut\0"
+	"abovedot\0"
+	"Oacute\0"
+	"Babovedot\0"
+	"acircumflextilde\0"
+	"itilde\0"
+	"ballotcross\0"
+	"Thai_honokhuk\0"
+	"Arabic_ra\0"
+	"braceright\0"
+	"w\0"
+	"checkerboard\0"
+	"Hangul_KkogjiDalrinIeung\0"
+	"braille_dots_3678\0"
+	"X\0"
+	"Tcedilla\0"
+	"Cyrillic_SHA\0"
+	"Macedonia_DSE\0"
+	"lbelowdot\0"
+	"Greek_upsilondieresis\0"
+	"braceleft\0"
+	"doubledagger\0"
+	"hyphen\0"
+	"braille_dots_2356\0"
+	"Thai_moma\0"
+	"braille_dots_1578\0"
+	"horizlinescan9\0"
+	"t\0"
+	"braille_dots_1348\0"
+	"uprightcorner\0"
+	"braille_dots_1235\0"
+	"digitspace\0"
+	"Cyrillic_I\0"
+	"q\0"
+	"Ecircumflexgrave\0"
+	"aacute\0"
+	"omacron\0"
+	"Sinh_kha\0"
+	"Armenian_but\0"
+	"braille_dots_2358\0"
+	"Racute\0"
+	"Farsi_2\0"
+	"Armenian_khe\0"
+	"logicaland\0"
+	"Sinh_ru2\0"
+	"braille_dots_346\0"
+	"braille_dots_3\0"
+	"Thai_khokhai\0"
+	"Serbian_LJE\0"
+	"checkmark\0"
+	"braille_dots_24\0"
+	"braille_dots_234568\0"
+	"Hangul_RieulKiyeog\0"
+	"Cyrillic_schwa\0"
+	"variation\0"
+	"Sinh_mba\0"
+	"Farsi_3\0"
+	"lowrightcorner\0"
+	"Thai_thothung\0"
+	"Hangul_J_Mieum\0"
+	"Cyrillic_de\0"
+	"eightsuperior\0"
+	"logicalor\0"
+	"braille_dots_13678\0"
+	"braille_dots_23457\0"
+	"zerosuperior\0"
+	"Sinh_aee\0"
+	"elementof\0"
+	"Gabovedot\0"
+	"Hangul_Kiyeog\0"
+	"Hangul_J_RieulKiyeog\0"
+	"asciicircum\0"
+	"Farsi_9\0"
+	"Ediaeresis\0"
+	"lcaron\0"
+	"ahook\0"
+	"sacute\0"
+	"5\0"
+	"Cyrillic_VE\0"
+	"Thai_maitri\0"
+	"Sinh_la\0"
+	"ecaron\0"
+	"acircumflexbelowdot\0"
+	"lcedilla\0"
+	"braille_dots_124578\0"
+	"botintegral\0"
+	"kana_NA\0"
+	"Georgian_vin\0"
+	"braille_dots_1234567\0"
+	"horizlinescan3\0"
+	"Greek_KAPPA\0"
+	"Serbian_dje\0"
+	"Armenian_ben\0"
+	"Georgian_har\0"
+	"toprightparens\0"
+	"braille_dots_68\0"
+	"Sabovedot\0"
+	"Hangul_J_Jieuj\0"
+	"Ograve\0"
+	"horizconnector\0"
+	"Thai_saraae\0"
+	"ytilde\0"
+	"Hangul_RieulSios\0"
+	"hebrew_qoph\0"
+	"braille_dots_457\0"
+	"zstroke\0"
+	"iacute\0"
+	"fivesuperior\0"
+	"Georgian_hae\0"
+	"em3space\0"
+	"amacron\0"
+	"braille_dots_4678\0"
+	"yhook\0"
+	"rightarrow\0"
+	"Lstroke\0"
+	"braille_dots_23468\0"
+	"braille_dots_1567\0"
+	"Cyrillic_DZHE\0"
+	"Greek_SIGMA\0"
+	"rcedilla\0"
+	"Hangul_A\0"
+	"Ecircumflexbelowdot\0"
+	"fabovedot\0"
+	"Sinh_dha\0"
+	"Thai_lekhok\0"
+	"hebrew_gimmel\0"
+	"Sinh_gha\0"
+	"Hangul_AraeA\0"
+	"Thai_maitho\0"
+	"braille_dots_47\0"
+	"Greek_LAMDA\0"
+	"braille_dots_6\0"
+	"emptyset\0"
+	"PesetaSign\0"
+	"Arabic_thal\0"
+	"Georgian_don\0"
+	"Greek_UPSILON\0"
+	"kana_TU\0"
+	"Farsi_5\0"
+	"opentribulletup\0"
+	"uhorn\0"
+	"slash\0"
+	"Ocircumflexacute\0"
+	"leftmiddlecurlybrace\0"
+	"bracketleft\0"
+	"zerosubscript\0"
+	"odoubleacute\0"
+	"Cyrillic_ha\0"
+	"Thai_sarai\0"
+	"nobreakspace\0"
+	"apostrophe\0"
+	"Arabic_question_mark\0"
+	"Hangul_PanSios\0"
+	"kana_middledot\0"
+	"braille_dots_145678\0"
+	"Cyrillic_sha\0"
+	"Armenian_men\0"
+	"Sinh_ai\0"
+	"Utilde\0"
+	"Cyrillic_BE\0"
+	"Thai_ngongu\0"
+	"kana_ME\0"
+	"Rcedilla\0"
+	"braille_dots_13\0"
+	"braille_dots_468\0"
+	"n\0"
+	"braille_dots_167\0"
+	"Cyrillic_je\0"
+	"Greek_eta\0"
+	"Cyrillic_ha_descender\0"
+	"Greek_EPSILON\0"
+	"horizlinescan1\0"
+	"Thai_leksong\0"
+	"enfilledcircbullet\0"
+	"braille_dots_34578\0"
+	"Cyrillic_ZE\0"
+	"braille_dots_16\0"
+	"E\0"
+	"braille_dots_2378\0"
+	"Sinh_ee2\0"
+	"yen\0"
+	"Uhornacute\0"
+	"T\0"
+	"braille_dots_34\0"
+	"imacron\0"
+	"leftpointer\0"
+	"Ibreve\0"
+	"eth\0"
+	"Georgian_can\0"
+	"Georgian_un\0"
+	"Hangul_RieulTieut\0"
+	"braille_dots_12345\0"
+	"Armenian_yentamna\0"
+	"onesubscript\0"
+	"Arabic_feh\0"
+	"Armenian_full_stop\0"
+	"braille_dots_2468\0"
+	"braille_dots_13456\0"
+	"KP_Divide\0"
+	"Thai_lochula\0"
+	"KP_Add\0"
+	"tabovedot\0"
+	"braille_dots_1257\0"
+	"D\0"
+	"zabovedot\0"
+	"kana_MI\0"
+	"braille_dots_123478\0"
+	"Cyrillic_EF\0"
+	"braille_dots_1457\0"
+	"ncaron\0"
+	"Thai_wowaen\0"
+	"crossinglines\0"
+	"kana_HE\0"
+	"braille_dots_13568\0"
+	"Armenian_ghat\0"
+	"Gcircumflex\0"
+	"Ocircumflexhook\0"
+	"Sinh_ja\0"
+	"Ukranian_je\0"
+	"Cyrillic_nje\0"
+	"Hangul_J_YeorinHieuh\0"
+	"CruzeiroSign\0"
+	"euro\0"
+	"braille_dots_268\0"
+	"Thai_dochada\0"
+	"Cyrillic_ef\0"
+	"braille_dots_12567\0"
+	"twosuperior\0"
+	"Armenian_vyun\0"
+	"Greek_lamda\0"
+	"Hangul_J_NieunJieuj\0"
+	"hebrew_lamed\0"
+	"Thai_thophuthao\0"
+	"leftanglebracket\0"
+	"fiveeighths\0"
+	"plusminus\0"
+	"hebrew_dalet\0"
+	"Armenian_VO\0"
+	"braille_dots_3457\0"
+	"braille_dots_14\0"
+	"Sinh_pa\0"
+	"braille_dots_578\0"
+	"Udiaeresis\0"
+	"Hangul_YA\0"
+	"horizlinescan5\0"
+	"braille_dots_12578\0"
+	"topleftradical\0"
+	"FFrancSign\0"
+	"braille_dots_1345678\0"
+	"KP_6\0"
+	"Sinh_ae\0"
+	"Cyrillic_ka\0"
+	"Uhornhook\0"
+	"a\0"
+	"Arabic_tah\0"
+	"kcedilla\0"
+	"braille_dots_1346\0"
+	"Zcaron\0"
+	"exclamdown\0"
+	"f\0"
+	"Farsi_4\0"
+	"ETH\0"
+	"containsas\0"
+	"ooblique\0"
+	"Cyrillic_che\0"
+	"Hangul_SunkyeongeumPhieuf\0"
+	"uacute\0"
+	"Ohornbelowdot\0"
+	"asterisk\0"
+	"braille_dots_12356\0"
+	"Sinh_o\0"
+	"Adiaeresis\0"
+	"braille_dots_1268\0"
+	"ssharp\0"
+	"Eogonek\0"
+	"dollar\0"
+	"parenright\0"
+	"ograve\0"
+	"Ntilde\0"
+	"Sinh_e2\0"
+	"thinspace\0"
+	"ninesubscript\0"
+	"gcaron\0"
+	"Ukrainian_ie\0"
+	"Armenian_gim\0"
+	"hebrew_nun\0"
+	"kana_a\0"
+	"topleftsqbracket\0"
+	"Thai_thothan\0"
+	"braille_dots_678\0"
+	"braille_dots_2457\0"
+	"etilde\0"
+	"Cyrillic_shcha\0"
+	"Hangul_AE\0"
+	"Hangul_PieubSios\0"
+	"braille_dots_34567\0"
+	"ohornbelowdot\0"
+	"emopencircle\0"
+	"Georgian_kan\0"
+	"braille_dots_123568\0"
+	"ycircumflex\0"
+	"partialderivative\0"
+	"Sinh_ka\0"
+	"greaterthanequal\0"
+	"Hangul_YEO\0"
+	"Sinh_rii\0"
+	"Y\0"
+	"Cyrillic_u_macron\0"
+	"kana_YO\0"
+	"Cyrillic_TE\0"
+	"Armenian_paruyk\0"
+	"topt\0"
+	"hebrew_aleph\0"
+	"Armenian_ho\0"
+	"upstile\0"
+	"Armenian_yech\0"
+	"upshoe\0"
+	"Jcircumflex\0"
+	"Greek_epsilonaccent\0"
+	"ifonlyif\0"
+	"kana_closingbracket\0"
+	"Farsi_7\0"
+	"ocircumflexacute\0"
+	"braille_dots_5\0"
+	"Thai_choching\0"
+	"Armenian_o\0"
+	"Acircumflexhook\0"
+	"braille_dots_12467\0"
+	"Cyrillic_ZHE_descender\0"
+	"Arabic_comma\0"
+	"Armenian_CHA\0"
+	"onethird\0"
+	"braille_dots_178\0"
+	"odiaeresis\0"
+	"ocaron\0"
+	"greater\0"
+	"Ohorntilde\0"
+	"Arabic_alef\0"
+	"braille_dots_2568\0"
+	"Greek_lambda\0"
+	"Aogonek\0"
+	"kana_TSU\0"
+	"includes\0"
+	"kana_YA\0"
+	"atilde\0"
+	"braille_dots_136\0"
+	"Georgian_we\0"
+	"ocircumflex\0"
+	"kana_e\0"
+	"Armenian_JE\0"
+	"Armenian_re\0"
+	"Gbreve\0"
+	"Scedilla\0"
+	"kana_KO\0"
+	"parenleft\0"
+	"Hangul_Sios\0"
+	"semicolon\0"
+	"therefore\0"
+	"ecircumflexbelowdot\0"
+	"Arabic_hamzaonalef\0"
+	"tcaron\0"
+	"kana_YU\0"
+	"braille_dots_14568\0"
+	"Hangul_RieulMieum\0"
+	"Odoubleacute\0"
+	"Serbian_je\0"
+	"notapproxeq\0"
+	"bar\0"
+	"Cyrillic_O\0"
+	"Hangul_J_PanSios\0"
+	"ColonSign\0"
+	"function\0"
+	"Cyrillic_HA\0"
+	"L\0"
+	"kana_A\0"
+	"Greek_gamma\0"
+	"Greek_TAU\0"
+	"4\0"
+	"Hangul_SsangDikeud\0"
+	"Armenian_TCHE\0"
+	"Cyrillic_ghe\0"
+	"braille_dots_15678\0"
+	"prescription\0"
+	"dcaron\0"
+	"ecircumflexgrave\0"
+	"rightt\0"
+	"Thai_totao\0"
+	"Thai_loling\0"
+	"Ehook\0"
+	"braille_dots_168\0"
+	"B\0"
+	"emspace\0"
+	"uring\0"
+	"Cyrillic_YERU\0"
+	"Thai_leknung\0"
+	"Delete\0"
+	"Armenian_da\0"
+	"braille_dots_358\0"
+	"Arabic_sukun\0"
+	"endash\0"
+	"guillemotleft\0"
+	"braille_dots_256\0"
+	"Ukrainian_GHE_WITH_UPTURN\0"
+	"Armenian_vo\0"
+	"femalesymbol\0"
+	"Cyrillic_em\0"
+	"percent\0"
+	"Thai_saraii\0"
+	"figdash\0"
+	"Georgian_he\0"
+	"fivesixths\0"
+	"Linefeed\0"
+	"lessthanequal\0"
+	"racute\0"
+	"Cyrillic_io\0"
+	"kana_KU\0"
+	"Hangul_RieulHieuh\0"
+	"Arabic_kaf\0"
+	"S\0"
+	"ohorntilde\0"
+	"onequarter\0"
+	"Hangul_KiyeogSios\0"
+	"telephone\0"
+	"Sinh_u\0"
+	"Tcaron\0"
+	"Greek_iotaaccent\0"
+	"Ncaron\0"
+	"cacute\0"
+	"foursubscript\0"
+	"nl\0"
+	"Arabic_shadda\0"
+	"Rcaron\0"
+	"Arabic_fullstop\0"
+	"Greek_PSI\0"
+	"KP_Enter\0"
+	"Armenian_HI\0"
+	"Armenian_lyun\0"
+	"Armenian_tsa\0"
+	"Armenian_to\0"
+	"combining_grave\0"
+	"enspace\0"
+	"Thai_phophung\0"
+	"Thai_ru\0"
+	"braille_dots_458\0"
+	"KP_Space\0"
+	"Greek_IOTAaccent\0"
+	"Ccaron\0"
+	"Serbian_JE\0"
+	"Arabic_kasra\0"
+	"braille_dots_13567\0"
+	"braille_dots_4568\0"
+	"kappa\0"
+	"threesubscript\0"
+	"Farsi_yeh\0"
+	"Sacute\0"
+	"ellipsis\0"
+	"Arabic_tehmarbuta\0"
+	"braille_dots_3567\0"
+	"Armenian_DZA\0"
+	"Georgian_ghan\0"
+	"braille_dots_23567\0"
+	"l\0"
+	"emfilledrect\0"
+	"braille_dots_1246\0"
+	"Armenian_SE\0"
+	"Sinh_aa\0"
+	"twosubscript\0"
+	"Arabic_6\0"
+	"Arabic_waw\0"
+	"kana_NE\0"
+	"U\0"
+	"Thai_maiyamok\0"
+	"scedilla\0"
+	"F\0"
+	"fourthroot\0"
+	"Ytilde\0"
+	"Armenian_SHA\0"
+	"Arabic_heh_goal\0"
+	"Greek_NU\0"
+	"KP_3\0"
+	"kana_O\0"
+	"kana_HU\0"
+	"ordfeminine\0"
+	"kana_yu\0"
+	"Ihook\0"
+	"braille_dots_134567\0"
+	"Armenian_DA\0"
+	"braille_dots_14567\0"
+	"otilde\0"
+	"braille_dots_23467\0"
+	"Thai_khorakhang\0"
+	"Arabic_hamzaonyeh\0"
+	"Byelorussian_shortu\0"
+	"Arabic_hamzaonwaw\0"
+	"Hangul_J_Pieub\0"
+	"N\0"
+	"leftsinglequotemark\0"
+	"kana_yo\0"
+	"braille_dots_124568\0"
+	"Thai_maitaikhu\0"
+	"braille_dots_4578\0"
+	"notidentical\0"
+	"braille_dots_1368\0"
+	"eabovedot\0"
+	"Thai_chochang\0"
+	"Armenian_ke\0"
+	"hebrew_samekh\0"
+	"braille_dots_357\0"
+	"Sinh_ng2\0"
+	"braille_dots_34568\0"
+	"Abrevehook\0"
+	"braille_dots_23678\0"
+	"Greek_horizbar\0"
+	"hstroke\0"
+	"Hangul_J_RieulHieuh\0"
+	"braille_dots_1245678\0"
+	"Arabic_tteh\0"
+	"braille_dots_13478\0"
+	"periodcentered\0"
+	"ccircumflex\0"
+	"Armenian_GIM\0"
+	"filledlefttribullet\0"
+	"braille_dots_18\0"
+	"KP_Separator\0"
+	"kana_TO\0"
+	"Sinh_aa2\0"
+	"braille_dots_2478\0"
+	"Thai_paiyannoi\0"
+	"ntilde\0"
+	"kana_I\0"
+	"braille_dots_4567\0"
+	"Arabic_ghain\0"
+	"braille_dots_1357\0"
+	"Tab\0"
+	"braille_dots_46\0"
+	"Abrevegrave\0"
+	"botrightsqbracket\0"
+	"Sinh_oo\0"
+	"Thai_sarauee\0"
+	"Eabovedot\0"
+	"questiondown\0"
+	"kana_NI\0"
+	"braille_dots_245678\0"
+	"J\0"
+	"Imacron\0"
+	"Cyrillic_softsign\0"
+	"seveneighths\0"
+	"y\0"
+	"Armenian_TYUN\0"
+	"oe\0"
+	"Sinh_jnya\0"
+	"hebrew_daleth\0"
+	"V\0"
+	"braille_dots_1267\0"
+	"Armenian_LYUN\0"
+	"Greek_CHI\0"
+	"Armenian_E\0"
+	"KP_Multiply\0"
+	"Igrave\0"
+	"Greek_iota\0"
+	"ENG\0"
+	"Armenian_separation_mark\0"
+	"braille_dots_2346\0"
+	"Sinh_lu2\0"
+	"Ccircumflex\0"
+	"braille_dots_158\0"
+	"braille_dots_24567\0"
+	"Cyrillic_zhe_descender\0"
+	"downtack\0"
+	"Ohornacute\0"
+	"c\0"
+	"braille_dots_1345\0"
+	"adiaeresis\0"
+	"hebrew_ayin\0"
+	"Cyrillic_KA_descender\0"
+	"braille_dots_1356\0"
+	"braille_dots_157\0"
+	"Thai_kokai\0"
+	"hebrew_zade\0"
+	"Cyrillic_EN_descender\0"
+	"Ocircumflexbelowdot\0"
+	"Cyrillic_es\0"
+	"Greek_MU\0"
+	"braille_dots_1458\0"
+	"Cyrillic_ze\0"
+	"braille_dots_12346\0"
+	"braille_dots_28\0"
+	"Arabic_hah\0"
+	"openrectbullet\0"
+	"Ygrave\0"
+	"Cyrillic_SHORTI\0"
+	"uhornhook\0"
+	"gbreve\0"
+	"kana_TE\0"
+	"registered\0"
+	"Wacute\0"
+	"braille_dots_1278\0"
+	"ecircumflexacute\0"
+	"Sinh_ya\0"
+	"braille_dots_1256\0"
+	"braille_dots_23\0"
+	"LiraSign\0"
+	"Lcedilla\0"
+	"Hangul_RieulYeorinHieuh\0"
+	"Greek_ALPHA\0"
+	"Greek_ETAaccent\0"
+	"MillSign\0"
+	"Fabovedot\0"
+	"Arabic_zah\0"
+	"uhorngrave\0"
+	"braille_dots_12368\0"
+	"Cyrillic_HARDSIGN\0"
+	"Greek_delta\0"
+	"hebrew_kaph\0"
+	"braille_dots_123578\0"
+	"Sinh_lla\0"
+	"Thai_saraaimaimuan\0"
+	"Cyrillic_CHE_vertstroke\0"
+	"hairspace\0"
+	"rightpointer\0"
+	"Hangul_SsangKiyeog\0"
+	"Cyrillic_U_macron\0"
+	"Return\0"
+	"KP_Equal\0"
+	"kana_CHI\0"
+	"KP_4\0"
+	"Thai_sarao\0"
+	"KP_2\0"
+	"Hangul_J_RieulSios\0"
+	"Abrevetilde\0"
+	"braille_dots_15\0"
+	"braille_dots_1467\0"
+	"THORN\0"
+	"Thai_popla\0"
+	"diaeresis\0"
+	"idotless\0"
+	"hebrew_samech\0"
+	"Udoubleacute\0"
+	"Gcedilla\0"
+	"kana_HA\0"
+	"Sinh_kunddaliya\0"
+	"R\0"
+	"braille_dots_4\0"
+	"onesuperior\0"
+	"Scaron\0"
+	"kana_E\0"
+	"Sinh_ae2\0"
+	"Arabic_yeh\0"
+	"opentribulletdown\0"
+	"Ohorngrave\0"
+	"braille_dots_1468\0"
+	"kana_comma\0"
+	"Sinh_ma\0"
+	"ff\0"
+	"identical\0"
+	"acute\0"
+	"Greek_phi\0"
+	"Sinh_nna\0"
+	"Cyrillic_zhe\0"
+	"aogonek\0"
+	"braille_dots_36\0"
+	"Arabic_gaf\0"
+	"Greek_epsilon\0"
+	"Armenian_ZHE\0"
+	"braille_dots_37\0"
+	"braille_dots_123567\0"
+	"Dstroke\0"
+	"threesuperior\0"
+	"paragraph\0"
+	"Cyrillic_KA\0"
+	"Cyrillic_e\0"
+	"comma\0"
+	"Greek_PI\0"
+	"Thai_sarau\0"
+	"abrevetilde\0"
+	"braille_dots_2456\0"
+	"combining_hook\0"
+	"twothirds\0"
+	"Georgian_xan\0"
+	"abreveacute\0"
+	"wdiaeresis\0"
+	"ohornacute\0"
+	"Arabic_dammatan\0"
+	"Uring\0"
+	"ohornhook\0"
+	"Greek_OMEGA\0"
+	"Georgian_ban\0"
+	"Greek_pi\0"
+	"hebrew_finalzade\0"
+	"Ycircumflex\0"
+	"hebrew_finalnun\0"
+	"braille_dots_1234\0"
+	"braille_dots_3456\0"
+	"Armenian_je\0"
+	"Iacute\0"
+	"braille_dots_1478\0"
+	"Georgian_khar\0"
+	"Arabic_qaf\0"
+	"ccedilla\0"
+	"Thai_maiek\0"
+	"botleftsqbracket\0"
+	"xabovedot\0"
+	"horizlinescan7\0"
+	"Cyrillic_PE\0"
+	"Sinh_u2\0"
+	"Atilde\0"
+	"quoteright\0"
+	"Aring\0"
+	"braille_dots_127\0"
+	"uogonek\0"
+	"Cyrillic_el\0"
+	"kana_conjunctive\0"
+	"Hangul_J_SsangSios\0"
+	"Hangul_YE\0"
+	"Georgian_jhan\0"
+	"braille_dots_7\0"
+	"kana_SU\0"
+	"braille_dots_124\0"
+	"DongSign\0"
+	"hebrew_finalkaph\0"
+	"Sinh_thha\0"
+	"ehook\0"
+	"sabovedot\0"
+	"braille_dots_245\0"
+	"Cyrillic_shha\0"
+	"Omacron\0"
+	"Armenian_KHE\0"
+	"Cyrillic_en\0"
+	"braille_dots_1568\0"
+	"braille_dots_135678\0"
+	"Cyrillic_yeru\0"
+	"braille_dots_348\0"
+	"Eacute\0"
+	"braille_dots_1347\0"
+	"degree\0"
+	"braille_dots_12348\0"
+	"heart\0"
+	"braille_dots_23578\0"
+	"braille_dots_124567\0"
+	"Hangul_J_Tieut\0"
+	"braille_dots_24678\0"
+	"Ccedilla\0"
+	"8\0"
+	"Thai_saraaimaimalai\0"
+	"Hangul_J_Rieul\0"
+	"section\0"
+	"Greek_UPSILONdieresis\0"
+	"Arabic_farsi_yeh\0"
+	"Hangul_Tieut\0"
+	"Uhorntilde\0"
+	"Sinh_ai2\0"
+	"braille_dots_1\0"
+	"sixsubscript\0"
+	"ediaeresis\0"
+	"Kcedilla\0"
+	"Serbian_nje\0"
+	"Thai_thothong\0"
+	"Cyrillic_u\0"
+	"because\0"
+	"Armenian_tso\0"
+	"kana_RE\0"
+	"minus\0"
+	"braille_dots_12357\0"
+	"braille_dots_248\0"
+	"braille_dots_12347\0"
+	"kana_WA\0"
+	"kana_FU\0"
+	"combining_tilde\0"
+	"braille_dots_138\0"
+	"Zacute\0"
+	"approximate\0"
+	"infinity\0"
+	"Cyrillic_CHE\0"
+	"Thai_saraue\0"
+	"Thai_leksam\0"
+	"braille_dots_13467\0"
+	"Sinh_ddha\0"
+	"Armenian_vev\0"
+	"braille_dots_145\0"
+	"Armenian_tche\0"
+	"Oslash\0"
+	"Arabic_dal\0"
+	"Sinh_nya\0"
+	"Obelowdot\0"
+	"b\0"
+	"Iogonek\0"
+	"braille_dots_14678\0"
+	"Arabic_heh_doachashmee\0"
+	"Armenian_question\0"
+	"Acircumflexbelowdot\0"
+	"Sinh_dda\0"
+	"Ukrainian_I\0"
+	"Sinh_o2\0"
+	"musicalflat\0"
+	"Cyrillic_SHCHA\0"
+	"umacron\0"
+	"braille_dots_234678\0"
+	"braille_dots_123456\0"
+	"Georgian_gan\0"
+	"Sinh_ra\0"
+	"braille_dots_235678\0"
+	"Armenian_apostrophe\0"
+	"Thai_oang\0"
+	"emdash\0"
+	"Thai_lekkao\0"
+	"Ecircumflexhook\0"
+	"Ohook\0"
+	"Sinh_ga\0"
+	"braille_dots_267\0"
+	"Sinh_al\0"
+	"Hangul_Mieum\0"
+	"Sinh_uu\0"
+	"schwa\0"
+	"Georgian_on\0"
+	"Cyrillic_CHE_descender\0"
+	"Armenian_KE\0"
+	"ihook\0"
+	"Armenian_HO\0"
+	"Cyrillic_ES\0"
+	"Armenian_hyphen\0"
+	"zcaron\0"
+	"Thai_sosua\0"
+	"kana_i\0"
+	"Georgian_fi\0"
+	"z\0"
+	"Sinh_ca\0"
+	"braille_dots_257\0"
+	"Armenian_ini\0"
+	"Clear\0"
+	"Cyrillic_U_straight\0"
+	"ydiaeresis\0"
+	"Armenian_INI\0"
+	"grave\0"
+	"kana_HO\0"
+	"braille_dots_57\0"
+	"hebrew_het\0"
+	"hebrew_zadi\0"
+	"righttack\0"
+	"Arabic_teh\0"
+	"Arabic_sad\0"
+	"9\0"
+	"braille_dots_135\0"
+	"Cyrillic_ve\0"
+	"combining_acute\0"
+	"2\0"
+	"question\0"
+	"ccaron\0"
+	"hebrew_chet\0"
+	"hebrew_beth\0"
+	"cent\0"
+	"braille_dots_25\0"
+	"openstar\0"
+	"braille_dots_5678\0"
+	"Thai_nikhahit\0"
+	"kana_ya\0"
+	"Greek_tau\0"
+	"ebelowdot\0"
+	"Armenian_cha\0"
+	"hebrew_doublelowline\0"
+	"fivesubscript\0"
+	"KP_5\0"
+	"kana_U\0"
+	"Farsi_1\0"
+	"Sinh_ii2\0"
+	"Sinh_pha\0"
+	"Greek_OMICRON\0"
+	"rightshoe\0"
+	"iogonek\0"
+	"backslash\0"
+	"braille_dots_123468\0"
+	"Hangul_OE\0"
+	"Hangul_J_Sios\0"
+	"hebrew_yod\0"
+	"ubelowdot\0"
+	"Georgian_man\0"
+	"ecircumflexhook\0"
+	"braille_dots_34678\0"
+	"ucircumflex\0"
+	"Hangul_Phieuf\0"
+	"Greek_nu\0"
+	"k\0"
+	"Sinh_tta\0"
+	"Thai_nonu\0"
+	"sixsuperior\0"
+	"Hangul_E\0"
+	"Greek_alpha\0"
+	"NewSheqelSign\0"
+	"vertconnector\0"
+	"braille_dots_8\0"
+	"filledtribulletup\0"
+	"Armenian_pyur\0"
+	"Armenian_PYUR\0"
+	"braille_dots_12678\0"
+	"Armenian_MEN\0"
+	"braille_dots_2345678\0"
+	"Armenian_RE\0"
+	"braille_dots_1238\0"
+	"igrave\0"
+	"Armenian_za\0"
+	"Hangul_J_Phieuf\0"
+	"Abreve\0"
+	"Arabic_alefmaksura\0"
+	"filledrectbullet\0"
+	"notequal\0"
+	"Sinh_i2\0"
+	"Abreveacute\0"
+	"telephonerecorder\0"
+	"musicalsharp\0"
+	"club\0"
+	"Byelorussian_SHORTU\0"
+	"braille_dots_1258\0"
+	"braille_dots_12345678\0"
+	"includedin\0"
+	"rightmiddlecurlybrace\0"
+	"Thai_soso\0"
+	"Georgian_phar\0"
+	"braille_dots_26\0"
+	"braille_dots_23568\0"
+	"Cyrillic_ER\0"
+	"babovedot\0"
+	"kana_RI\0"
+	"ibelowdot\0"
+	"braille_dots_123458\0"
+	"braille_blank\0"
+	"Ibelowdot\0"
+	"Sinh_ng\0"
+	"Sinh_luu2\0"
+	"Hangul_J_Ieung\0"
+	"Iabovedot\0"
+	"Georgian_nar\0"
+	"kra\0"
+	"braille_dots_123678\0"
+	"lf\0"
+	"Georgian_las\0"
+	"W\0"
+	"zacute\0"
+	"Thai_leksi\0"
+	"Ukranian_i\0"
+	"EZH\0"
+	"tslash\0"
+	"e\0"
+	"Zabovedot\0"
+	"braille_dots_467\0"
+	"numbersign\0"
+	"Hangul_Pieub\0"
+	"ninesuperior\0"
+	"braille_dots_2678\0"
+	"downstile\0"
+	"braille_dots_1358\0"
+	"Arabic_khah\0"
+	"Armenian_ligature_ew\0"
+	"Hstroke\0"
+	"Hangul_AraeAE\0"
+	"diamond\0"
+	"Cyrillic_be\0"
+	"Sinh_ri\0"
+	"Armenian_hi\0"
+	"braille_dots_2458\0"
+	"Thai_baht\0"
+	"kana_MA\0"
+	"Pabovedot\0"
+	"Armenian_ken\0"
+	"Greek_GAMMA\0"
+	"Ebelowdot\0"
+	"Hangul_WI\0"
+	"Armenian_e\0"
+	"Tabovedot\0"
+	"braille_dots_12\0"
+	"Hangul_WEO\0"
+	"Cyrillic_I_macron\0"
+	"prolongedsound\0"
+	"squareroot\0"
+	"Greek_omegaaccent\0"
+	"Hangul_Cieuc\0"
+	"Cyrillic_O_bar\0"
+	"malesymbol\0"
+	"0\0"
+	"Hangul_SsangSios\0"
+	"Hangul_YAE\0"
+	"hebrew_mem\0"
+	"Thai_saraam\0"
+	"Cyrillic_SCHWA\0"
+	"kana_tu\0"
+	"lefttack\0"
+	"Greek_OMICRONaccent\0"
+	"Ocircumflex\0"
+	"Hangul_J_NieunHieuh\0"
+	"braille_dots_2345\0"
+	"Georgian_tar\0"
+	"Georgian_shin\0"
+	"udoubleacute\0"
+	"maltesecross\0"
+	"Cyrillic_te\0"
+	"braille_dots_126\0"
+	"gcedilla\0"
+	"Hangul_J_Khieuq\0"
+	"braille_dots_1234568\0"
+	"kana_RO\0"
+	"Arabic_veh\0"
+	"braille_dots_12468\0"
+	"Ukrainian_ghe_with_upturn\0"
+	"kana_KI\0"
+	"Acircumflexgrave\0"
+	"colon\0"
+	"Ukranian_JE\0"
+	"Thorn\0"
+	"KP_7\0"
+	"Greek_PHI\0"
+	"acircumflexhook\0"
+	"Zstroke\0"
+	"Hangul_NieunJieuj\0"
+	"Greek_accentdieresis\0"
+	"Armenian_ayb\0"
+	"7\0"
+	"Cyrillic_JE\0"
+	"careof\0"
+	"Greek_IOTAdieresis\0"
+	"Cyrillic_EM\0"
+	"braille_dots_25678\0"
+	"braille_dots_2\0"
+	"cr\0"
+	"Cyrillic_u_straight_bar\0"
+	"Georgian_hoe\0"
+	"leftdoublequotemark\0"
+	"numerosign\0"
+	"kana_RU\0"
+	"intersection\0"
+	"Wcircumflex\0"
+	"Thai_khokhwai\0"
+	"uparrow\0"
+	"braille_dots_345\0"
+	"Arabic_theh\0"
+	"Amacron\0"
+	"Serbian_tshe\0"
+	"latincross\0"
+	"1\0"
+	"Arabic_dad\0"
+	"macron\0"
+	"Armenian_nu\0"
+	"s\0"
+	"Hangul_YU\0"
+	"Farsi_0\0"
+	"hebrew_gimel\0"
+	"Arabic_maddaonalef\0"
+	"kana_TI\0"
+	"Thai_leksun\0"
+	"Cyrillic_lje\0"
+	"braille_dots_2467\0"
+	"oslash\0"
+	"braille_dots_478\0"
+	"Thai_maihanakat\0"
+	"Ybelowdot\0"
+	"Greek_ALPHAaccent\0"
+	"kana_SE\0"
+	"semivoicedsound\0"
+	"equal\0"
+	"Sinh_ba\0"
+	"ohorngrave\0"
+	"braille_dots_235\0"
+	"Cyrillic_dzhe\0"
+	"NairaSign\0"
+	"Hangul_SsangPieub\0"
+	"permille\0"
+	"Thai_yoying\0"
+	"Thai_lu\0"
+	"foursuperior\0"
+	"Sinh_sha\0"
+	"Arabic_seen\0"
+	"dabovedot\0"
+	"ht\0"
+	"Hangul_NieunHieuh\0"
+	"Gcaron\0"
+	"Ukrainian_i\0"
+	"braille_dots_45\0"
+	"braille_dots_1234578\0"
+	"Hangul_J_SsangKiyeog\0"
+	"eng\0"
+	"braille_dots_1234678\0"
+	"Arabic_lam\0"
+	"Arabic_hamza\0"
+	"Thai_chochan\0"
+	"Ukrainian_YI\0"
+	"KP_8\0"
+	"hebrew_finalpe\0"
+	"6\0"
+	"acircumflex\0"
+	"Cyrillic_SOFTSIGN\0"
+	"quoteleft\0"
+	"Thai_thothahan\0"
+	"Cyrillic_i_macron\0"
+	"braille_dots_123457\0"
+	"Hangul_Dikeud\0"
+	"Odiaeresis\0"
+	"Armenian_accent\0"
+	"ybelowdot\0"
+	"Armenian_dza\0"
+	"Sinh_uu2\0"
+	"onesixth\0"
+	"Dabovedot\0"
+	"Georgian_an\0"
+	"braille_dots_1248\0"
+	"voicedsound\0"
+	"integral\0"
+	"Cyrillic_ka_vertstroke\0"
+	"wgrave\0"
+	"doubbaselinedot\0"
+	"Lcaron\0"
+	"braille_dots_24578\0"
+	"Hangul_SsangJieuj\0"
+	"Cyrillic_ya\0"
+	"braille_dots_14578\0"
+	"Greek_DELTA\0"
+	"kana_SA\0"
+	"threeeighths\0"
+	"Uhorn\0"
+	"Hangul_J_KiyeogSios\0"
+	"M\0"
+	"braille_dots_13458\0"
+	"approxeq\0"
+	"braille_dots_12457\0"
+	"AE\0"
+	"braille_dots_17\0"
+	"Etilde\0"
+	"braille_dots_134678\0"
+	"braille_dots_1367\0"
+	"jot\0"
+	"Thai_lakkhangyao\0"
+	"punctspace\0"
+	"braille_dots_278\0"
+	"Arabic_percent\0"
+	"Arabic_meem\0"
+	"topleftparens\0"
+	"Hangul_Nieun\0"
+	"hebrew_taw\0"
+	"Mabovedot\0"
+	"Cyrillic_LJE\0"
+	"braille_dots_78\0"
+	"Armenian_exclam\0"
+	"braille_dots_2347\0"
+	"partdifferential\0"
+	"Greek_XI\0"
+	"masculine\0"
+	"Armenian_ra\0"
+	"abrevegrave\0"
+	"Sinh_au\0"
+	"Greek_alphaaccent\0"
+	"Greek_sigma\0"
+	"eightsubscript\0"
+	"quad\0"
+	"Uhorngrave\0"
+	"combining_belowdot\0"
+	"Armenian_shesht\0"
+	"Sinh_fa\0"
+	"braille_dots_567\0"
+	"onefifth\0"
+	"mabovedot\0"
+	"Hangul_O\0"
+	"dagger\0"
+	"kana_u\0"
+	"Cyrillic_er\0"
+	"Egrave\0"
+	"kana_TA\0"
+	"Idiaeresis\0"
+	"braille_dots_2578\0"
+	"Armenian_PE\0"
+	"Cyrillic_IE\0"
+	"Hangul_SunkyeongeumPieub\0"
+	"kana_fullstop\0"
+	"braille_dots_238\0"
+	"Ecircumflex\0"
+	"rightdoublequotemark\0"
+	"upleftcorner\0"
+	"abrevehook\0"
+	"filledtribulletdown\0"
+	"Hangul_J_Nieun\0"
+	"sevensuperior\0"
+	"Georgian_qar\0"
+	"Arabic_7\0"
+	"Z\0"
+	"doubleacute\0"
+	"Sinh_au2\0"
+	"Thai_saraa\0"
+	"cabovedot\0"
+	"braille_dots_1247\0"
+	"hebrew_resh\0"
+	"braille_dots_1237\0"
+	"kana_SHI\0"
+	"Hangul_YI\0"
+	"K\0"
+	"Ocircumflextilde\0"
+	"EuroSign\0"
+	"nabla\0"
+	"brokenbar\0"
+	"Macedonia_GJE\0"
+	"Armenian_TO\0"
+	"Armenian_FE\0"
+	"ygrave\0"
+	"braille_dots_13578\0"
+	"Arabic_kasratan\0"
+	"j\0"
+	"braille_dots_13468\0"
+	"Thai_sarae\0"
+	"Greek_mu\0"
+	"Hangul_WAE\0"
+	"Yacute\0"
+	"Eth\0"
+	"h\0"
+	"Cyrillic_KA_vertstroke\0"
+	"Hangul_J_Cieuc\0"
+	"Umacron\0"
+	"enopencircbullet\0"
+	"abelowdot\0"
+	"Thai_sosala\0"
+	"C\0"
+	"Sinh_nga\0"
+	"egrave\0"
+	"Armenian_TSA\0"
+	"scircumflex\0"
+	"braille_dots_378\0"
+	"braille_dots_456\0"
+	"Abrevebelowdot\0"
+	"dintegral\0"
+	"asciitilde\0"
+	"Thai_phinthu\0"
+	"Greek_upsilonaccentdieresis\0"
+	"Sinh_dhha\0"
+	"Hcircumflex\0"
+	"fourfifths\0"
+	"braille_dots_568\0"
+	"braille_dots_1678\0"
+	"Cyrillic_DE\0"
+	"udiaeresis\0"
+	"Sinh_oo2\0"
+	"BackSpace\0"
+	"guillemotright\0"
+	"braille_dots_23458\0"
+	"Greek_OMEGAaccent\0"
+	"braille_dots_12458\0"
+	"Cyrillic_YA\0"
+	"d\0"
+	"braille_dots_246\0"
+	"Thai_sarauu\0"
+	"ocircumflexhook\0"
+	"Armenian_at\0"
+	"Arabic_keheh\0"
+	"Ucircumflex\0"
+	"Arabic_0\0"
+	"hebrew_he\0"
+	"KP_Decimal\0"
+	"Greek_xi\0"
+	"Hangul_J_Kiyeog\0"
+	"Serbian_lje\0"
+	"Hangul_RieulPieub\0"
+	"hebrew_teth\0"
+	"singlelowquotemark\0"
+	"Cyrillic_TSE\0"
+	"sevensubscript\0"
+	"hebrew_bet\0"
+	"enfilledsqbullet\0"
+	"braille_dots_12358\0"
+	"Armenian_GHAT\0"
+	"kana_KE\0"
+	"Wdiaeresis\0"
+	"Georgian_hie\0"
+	"Cyrillic_GHE_bar\0"
+	"tcedilla\0"
+	"Greek_THETA\0"
+	"uptack\0"
+	"Cyrillic_YU\0"
+	"braille_dots_156\0"
+	"braille_dots_124678\0"
+	"Cyrillic_i\0"
+	"Hangul_J_KkogjiDalrinIeung\0"
+	"Sinh_ruu2\0"
+	"downshoe\0"
+	"thorn\0"
+	"Sinh_ii\0"
+	"sterling\0"
+	"KP_Subtract\0"
+	"Sinh_ee\0"
+	"Serbian_DJE\0"
+	"kana_N\0"
+	"Cyrillic_U_straight_bar\0"
+	"braille_dots_13457\0"
+	"Thai_yoyak\0"
+	"braille_dots_12367\0"
+	"Georgian_rae\0"
+	"Thai_rorua\0"
+	"Cyrillic_EN\0"
+	"Hangul_RieulPhieuf\0"
+	"Sinh_luu\0"
+	"Armenian_tyun\0"
+	"braille_dots_2367\0"
+	"Greek_ETA\0"
+	"SCHWA\0"
+	"Sinh_tha\0"
+	"Cyrillic_ghe_bar\0"
+	"similarequal\0"
+	"filledrighttribullet\0"
+	"Hangul_Jieuj\0"
+	"P\0"
+	"i\0"
+	"braille_dots_48\0"
+	"obelowdot\0"
+	"kana_HI\0"
+	"Arabic_8\0"
+	"vertbar\0"
+	"rightcaret\0"
+	"downarrow\0"
+	"gabovedot\0"
+	"Sinh_ndha\0"
+	"Greek_zeta\0"
+	"Greek_ZETA\0"
+	"Arabic_ha\0"
+	"leftcaret\0"
+	"Arabic_tatweel\0"
+	"braille_dots_23478\0"
+	"Arabic_ain\0"
+	"uhook\0"
+	"G\0"
+	"Arabic_noon\0"
+	"notsign\0"
+	"braille_dots_12456\0"
+	"x\0"
+	"Hangul_YO\0"
+	"Q\0"
+	"ezh\0"
+	"Cyrillic_o\0"
+	"twofifths\0"
+	"braille_dots_3468\0"
+	"implies\0"
+	"Armenian_pe\0"
+	"vt\0"
+	"Macedonia_gje\0"
+	"Ukranian_I\0"
+	"Hangul_J_RieulPhieuf\0"
+	"uhornacute\0"
+	"Sinh_lu\0"
+	"braille_dots_356\0"
+	"lacute\0"
+	"Arabic_yeh_baree\0"
+	"Ugrave\0"
+;
 
-template <typename M, typename K, typename V>
-static V at_default(M&& map, K&& key, V&& d)
+static constexpr uint32_t fnv1a(std::string_view str, uint32_t seed)
 {
-	auto keyVal = map.find(key);
-	if (keyVal == map.end()) {
-		return d;
+	auto h = uint32_t{2166136261u} ^ seed;
+	for (auto c : str) {
+		h = (h ^ (uint8_t)c) * 16777619u;
 	}
-
-	return keyVal->second;
+	h ^= h >> 15;
+	h *= 0x2c1b3c6du;
+	h ^= h >> 12;
+	return h;
 }
 
-uint16_t x11name_to_utf16(std::string const& x11name)
+uint16_t x11name_to_utf16(std::string_view x11name)
 {
-	// Have to break up the maps or build gets killed on RPi
-	if (auto utf16 = at_default(x11nameUtf16Map1, x11name, 0x0)) {
-		return utf16;
-	}
-	if (auto utf16 = at_default(x11nameUtf16Map2, x11name, 0x0)) {
-		return utf16;
-	}
-	if (auto utf16 = at_default(x11nameUtf16Map3, x11name, 0x0)) {
-		return utf16;
-	}
-	if (auto utf16 = at_default(x11nameUtf16Map4, x11name, 0x0)) {
-		return utf16;
-	}
-	if (auto utf16 = at_default(x11nameUtf16Map5, x11name, 0x0)) {
-		return utf16;
+	// Single probe: bucket seed selects the only slot the name can occupy
+	auto bucket = fnv1a(x11name, 0) % x11name_num_buckets;
+	auto slot = fnv1a(x11name, x11name_seeds[bucket]) % x11name_num_slots;
+
+	auto offs = x11name_offsets[slot];
+	auto name = std::string_view{&x11name_pool[offs],
+		(size_t)(x11name_offsets[slot + 1] - offs - 1)};
+	if (name != x11name) {
+		return 0x0;
 	}
 
-	return 0x0;
+	return x11name_utf16s[slot];
 }
-
@@ -1,9 +1,11 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdint.h>
 
 #include <string>
 #include <vector>
-#include <unordered_map>
+#include <algorithm>
+#include <unordered_set>
 
 extern "C" {
 #include <X11/Xlib.h>
@@ -18,9 +20,30 @@ extern "C" {
 00002010: 0204 ffff 6626 c825 fdff ffff 0904 ffff  ....f&.%........
 */
 
+struct Entry
+{
+	std::string name;
+	uint32_t utf16;
+};
+
+static auto entries = std::vector<Entry>{};
+
+// Must match hash emitted into src/x11name_to_utf16.cpp
+static uint32_t fnv1a(std::string const& str, uint32_t seed)
+{
+	auto h = uint32_t{2166136261u} ^ seed;
+	for (auto c : str) {
+		h = (h ^ (uint8_t)c) * 16777619u;
+	}
+	h ^= h >> 15;
+	h *= 0x2c1b3c6du;
+	h ^= h >> 12;
+	return h;
+}
+
 static void gen_line(std::string const& name)
 {
-	static auto first = true;
+	static auto seen = std::unordered_set<std::string>{};
 
 	auto ks = XStringToKeysym(name.c_str());
 	if (ks == NoSymbol) {
@@ -28,20 +51,160 @@ static void gen_line(std::string const& name)
 	}
 
 	auto utf32 = xkb_keysym_to_utf32(ks);
-	if ((0 < utf32) && (utf32 <= 0xffff)) {
-		printf("%s { \"%s\", 0x%x }\n",
-			(first) ? "{"  : ",",
-			name.c_str(), utf32);
-		first = false;
+	if ((0 < utf32) && (utf32 <= 0xffff) && seen.insert(name).second) {
+		entries.push_back(Entry{name, utf32});
 	}
 }
 
-int main(int argc, char** argv)
+// Hash-and-displace: names are grouped into buckets by an unseeded hash,
+// then each bucket is assigned the first seed that sends all of its names
+// to unused slots. Largest buckets are placed first.
+static auto build_seeds(size_t num_buckets, std::vector<uint32_t>& slot_entry)
 {
-	printf("#pragma once\n");
-	printf("#include <unordered_map>\n");
-	printf("static auto x11name_to_utf16 = std::unordered_map<std::string, uint16_t>\n");
+	auto const num_slots = entries.size();
+	auto seeds = std::vector<uint16_t>(num_buckets, 0);
+
+	auto buckets = std::vector<std::vector<uint32_t>>(num_buckets);
+	for (uint32_t i = 0; i < entries.size(); i++) {
+		buckets[fnv1a(entries[i].name, 0) % num_buckets].push_back(i);
+	}
+
+	auto order = std::vector<uint32_t>(num_buckets);
+	for (uint32_t i = 0; i < num_buckets; i++) {
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+		return buckets[a].size() > buckets[b].size();
+	});
+
+	auto const empty = uint32_t{0xffffffff};
+	slot_entry.assign(num_slots, empty);
+	for (auto bucket : order) {
+		if (buckets[bucket].empty()) {
+			break;
+		}
 
+		auto placed = false;
+		for (uint32_t seed = 1; !placed && (seed <= 0xffff); seed++) {
+			auto slots = std::vector<uint32_t>{};
+			for (auto i : buckets[bucket]) {
+				auto slot = fnv1a(entries[i].name, seed) % num_slots;
+				if ((slot_entry[slot] != empty)
+				 || (std::find(slots.begin(), slots.end(), slot) != slots.end())) {
+					break;
+				}
+				slots.push_back(slot);
+			}
+
+			if (slots.size() == buckets[bucket].size()) {
+				for (size_t j = 0; j < slots.size(); j++) {
+					slot_entry[slots[j]] = buckets[bucket][j];
+				}
+				seeds[bucket] = seed;
+				placed = true;
+			}
+		}
+
+		if (!placed) {
+			return std::vector<uint16_t>{};
+		}
+	}
+
+	return seeds;
+}
+
+static void gen_table()
+{
+	// Shrink bucket count until seeds no longer fit in 16 bits
+	auto slot_entry = std::vector<uint32_t>{};
+	auto seeds = std::vector<uint16_t>{};
+	for (auto keys_per_bucket : {4, 3, 2, 1}) {
+		auto num_buckets = (entries.size() + keys_per_bucket - 1) / keys_per_bucket;
+		seeds = build_seeds(num_buckets, slot_entry);
+		if (!seeds.empty()) {
+			break;
+		}
+	}
+	if (seeds.empty()) {
+		fprintf(stderr, "failed to build perfect hash\n");
+		exit(1);
+	}
+
+	printf("// Generated by x11map.cpp, do not edit\n\n");
+	printf("#include <cstdint>\n\n");
+	printf("#include <string_view>\n\n");
+	printf("// Minimal perfect hash over X11 keysym names. The unseeded hash of a name\n");
+	printf("// selects a bucket, whose seed rehashes the name into its unique slot.\n");
+	printf("// All tables are constant data: no static constructors or allocations.\n");
+	printf("static constexpr auto x11name_num_buckets = uint32_t{%zu};\n", seeds.size());
+	printf("static constexpr auto x11name_num_slots = uint32_t{%zu};\n\n", slot_entry.size());
+
+	printf("static constexpr uint16_t x11name_seeds[] =\n");
+	for (size_t i = 0; i < seeds.size(); i++) {
+		printf("%s0x%04x", (i == 0) ? "{ " : ((i % 8) == 0) ? "\n, " : ", ", seeds[i]);
+	}
+	printf("\n};\n\n");
+
+	printf("static constexpr uint16_t x11name_utf16s[] =\n");
+	for (size_t i = 0; i < slot_entry.size(); i++) {
+		printf("%s0x%04x", (i == 0) ? "{ " : ((i % 8) == 0) ? "\n, " : ", ",
+			entries[slot_entry[i]].utf16);
+	}
+	printf("\n};\n\n");
+
+	// Name of slot i spans [offsets[i], offsets[i + 1] - 1) in pool
+	auto offset = size_t{0};
+	printf("static constexpr uint16_t x11name_offsets[] =\n");
+	for (size_t i = 0; i <= slot_entry.size(); i++) {
+		printf("%s%zu", (i == 0) ? "{ " : ((i % 8) == 0) ? "\n, " : ", ", offset);
+		if (i < slot_entry.size()) {
+			offset += entries[slot_entry[i]].name.size() + 1;
+		}
+	}
+	printf("\n};\n\n");
+	if (offset > 0xffff) {
+		fprintf(stderr, "name pool exceeds 16-bit offsets\n");
+		exit(1);
+	}
+
+	printf("static constexpr char x11name_pool[] =\n");
+	for (size_t i = 0; i < slot_entry.size(); i++) {
+		printf("\t\"%s\\0\"\n", entries[slot_entry[i]].name.c_str());
+	}
+	printf(";\n\n");
+
+	printf("%s", R"(static constexpr uint32_t fnv1a(std::string_view str, uint32_t seed)
+{
+	auto h = uint32_t{2166136261u} ^ seed;
+	for (auto c : str) {
+		h = (h ^ (uint8_t)c) * 16777619u;
+	}
+	h ^= h >> 15;
+	h *= 0x2c1b3c6du;
+	h ^= h >> 12;
+	return h;
+}
+
+uint16_t x11name_to_utf16(std::string_view x11name)
+{
+	// Single probe: bucket seed selects the only slot the name can occupy
+	auto bucket = fnv1a(x11name, 0) % x11name_num_buckets;
+	auto slot = fnv1a(x11name, x11name_seeds[bucket]) % x11name_num_slots;
+
+	auto offs = x11name_offsets[slot];
+	auto name = std::string_view{&x11name_pool[offs],
+		(size_t)(x11name_offsets[slot + 1] - offs - 1)};
+	if (name != x11name) {
+		return 0x0;
+	}
+
+	return x11name_utf16s[slot];
+}
+)");
+}
+
+int main(int argc, char** argv)
+{
 	// name1\0name2\0\0
 	auto str = std::string{};
 	auto cursor = keysym_names;
@@ -61,7 +224,7 @@ int main(int argc, char** argv)
 		}
 	}
 
-	printf("};\n");
+	gen_table();
 
 	return 0;
 }